@@ -1,8 +1,13 @@
 #ifndef ACTION_RESULT_H
 #define ACTION_RESULT_H
 
+#include "../Core/StringRef.h"  // Literal-or-owned string used for protocol and content.
+#include "../Core/MemoryBudget.h"  // Budget reservation held for the data buffer.
+#include "../Core/CancellationToken.h"  // Deadline and cancellation of the item's processing.
+#include <cstddef>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 /**
@@ -24,6 +29,45 @@ enum class DataType {
     UNKNOWN         // Unidentified or unsupported types.
 };
 
+/**
+ * Number of DataType values. Used to size flat dispatch tables indexed by DataType.
+ */
+constexpr std::size_t kDataTypeCount = static_cast<std::size_t>(DataType::UNKNOWN) + 1;
+
+/**
+ * DataTypeName Function
+ * ---------------------
+ * Returns the canonical upper-case name of a DataType (as used in pipeline configuration files).
+ */
+inline const char* DataTypeName(DataType type) {
+    switch (type) {
+    case DataType::IMAGE:      return "IMAGE";
+    case DataType::JSON:       return "JSON";
+    case DataType::COMPRESSED: return "COMPRESSED";
+    case DataType::UNKNOWN:    return "UNKNOWN";
+    }
+    return "UNKNOWN";
+}
+
+/**
+ * ParseDataType Function
+ * ----------------------
+ * Parses a canonical DataType name (IMAGE, JSON, COMPRESSED, UNKNOWN).
+ *
+ * Returns:
+ * - bool: true and sets `type` when the name is valid, false otherwise.
+ */
+inline bool ParseDataType(const std::string& name, DataType& type) {
+    for (std::size_t i = 0; i < kDataTypeCount; ++i) {
+        DataType candidate = static_cast<DataType>(i);
+        if (name == DataTypeName(candidate)) {
+            type = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
 /**
  * ActionResult Class
  * ------------------
@@ -35,6 +79,11 @@ enum class DataType {
  * - Stores metadata as key/value pairs for traceability and auditing.
  * - Tracks the processing state to determine when the pipeline should stop.
  * - Simulates a data buffer to represent file contents.
+ * - Carries the cancellation token (batch cancellation and per-item deadline) that systems poll.
+ *
+ * Ownership:
+ * - ActionResult is move-only, so payloads and strings are never copied implicitly while an
+ *   item travels through loaders and systems. Use Clone() when a deep copy is really required.
  */
 class ActionResult {
 public:
@@ -43,19 +92,23 @@ public:
      * -------
      * - type (DataType): The detected type of the item (IMAGE, JSON, COMPRESSED, UNKNOWN).
      * - source (std::string): The original source of the item (file path, URL, etc.).
-     * - protocol (std::string): The protocol used (file, http, https, bundle, etc.).
-     * - content (std::string): A description of the content or the processed result.
+     * - protocol (StringRef): The protocol used (file, http, https, bundle, etc.).
+     * - content (StringRef): A description of the content or the processed result.
      * - isProcessed (bool): A flag indicating whether the item has been fully processed.
      * - metadata (std::unordered_map<std::string, std::string>): Key-value pairs for processing details.
      * - data (std::vector<char>): Simulated file data buffer (acts as a placeholder for actual content).
+     * - dataReservation (BudgetReservation): Memory budget reserved by the loader for `data`.
+     * - cancellation (CancellationToken): Cancelled when the batch is cancelled or the item's deadline passes.
      */
     DataType type;    // Type of the data (IMAGE, JSON, COMPRESSED, UNKNOWN).
     std::string source;   // Original source of the item (file path, URL, etc.).
-    std::string protocol; // Protocol used (file, http, https, bundle, etc.).
-    std::string content;  // Description of the content or processed result.
+    StringRef protocol;   // Protocol used (file, http, https, bundle, etc.).
+    StringRef content;    // Description of the content or processed result.
     bool isProcessed;     // Flag to indicate if the item has been fully processed.
     std::unordered_map<std::string, std::string> metadata;  // Key-value pairs for traceability.
     std::vector<char> data; // Simulated file data buffer (placeholder for actual content).
+    BudgetReservation dataReservation; // Budget held for data until the payload is released.
+    CancellationToken cancellation;    // Polled between processing steps (never cancelled by default).
 
     /**
      * Constructor
@@ -65,12 +118,67 @@ public:
      *
      * Parameters:
      * - tp (DataType): The detected type of the item.
-     * - sc (std::string): The original source of the item.
-     * - pt (std::string): The protocol used.
-     * - ct (std::string): A description of the content.
+     * - sc (std::string): The original source of the item (moved into the result).
+     * - pt (StringRef): The protocol used (usually a string literal).
+     * - ct (StringRef): A description of the content (usually a string literal).
+     */
+    ActionResult(DataType tp, std::string sc, StringRef pt, StringRef ct)
+        : type(tp), source(std::move(sc)), protocol(std::move(pt)), content(std::move(ct)), isProcessed(false) {
+    }
+
+    // Move-only: implicit copies of the payload are not allowed.
+    ActionResult(ActionResult&&) = default;
+    ActionResult& operator=(ActionResult&&) = default;
+    ActionResult(const ActionResult&) = delete;
+    ActionResult& operator=(const ActionResult&) = delete;
+
+    /**
+     * Clone Method
+     * ------------
+     * Creates an explicit deep copy of this ActionResult, including metadata and the data buffer.
+     * The copy does not hold a memory budget reservation, but shares the cancellation token.
+     *
+     * Returns:
+     * - ActionResult: An independent copy of this item.
+     */
+    ActionResult Clone() const {
+        ActionResult copy(type, source, protocol, content);
+        copy.isProcessed = isProcessed;
+        copy.metadata = metadata;
+        copy.data = data;
+        copy.cancellation = cancellation;
+        return copy;
+    }
+
+    /**
+     * ReleasePayload Method
+     * ---------------------
+     * Frees the data buffer and returns its memory budget reservation.
+     * Called once the item is fully processed; type, content and metadata are kept.
+     */
+    void ReleasePayload() {
+        std::vector<char>().swap(data);
+        dataReservation.Release();
+    }
+
+    /**
+     * StopIfCancelled Method
+     * ----------------------
+     * Checks the cancellation token. If it is cancelled, marks the item as processed, records why in
+     * the "Pipeline Stopped" metadata entry and releases the payload right away.
+     * Systems call it between steps of long-running work; executors call it between stages.
+     *
+     * Returns:
+     * - bool: true if the item was stopped (the caller should return without further work).
      */
-    ActionResult(DataType tp, std::string sc, std::string pt, std::string ct)
-        : type(tp), source(sc), protocol(pt), content(ct), isProcessed(false) {
+    bool StopIfCancelled() {
+        CancellationToken::CancelReason reason = cancellation.Reason();
+        if (reason == CancellationToken::CancelReason::NONE) return false;
+        metadata["Pipeline Stopped"] = (reason == CancellationToken::CancelReason::DEADLINE)
+                                           ? "Deadline exceeded" : "Cancelled";
+        isProcessed = true;
+        ReleasePayload();
+        return true;
     }
 };
 
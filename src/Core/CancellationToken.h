@@ -0,0 +1,117 @@
+#ifndef CANCELLATION_TOKEN_H
+#define CANCELLATION_TOKEN_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <utility>
+
+/**
+ * How often blocking waits (e.g., for memory budget or simulated latency) re-check a token,
+ * since tokens do not notify waiters when they are cancelled.
+ */
+constexpr std::chrono::milliseconds kCancellationPollInterval{ 5 };
+
+/**
+ * CancellationToken Class
+ * -----------------------
+ * Cooperative cancellation with optional deadlines, shared between the code that starts work and
+ * the code that performs it. Work is never interrupted: processors and executors poll the token
+ * between steps and stop on their own.
+ *
+ * Responsibilities:
+ * - Cancel: marks the token (and every token derived from it) as cancelled, from any thread.
+ * - WithDeadline: derives a child token that is also cancelled once a point in time has passed,
+ *   e.g., a per-item timeout under a batch token.
+ * - Reason: tells an explicit cancellation apart from an expired deadline.
+ *
+ * A default-constructed token can never be cancelled and costs nothing to check.
+ * Tokens are cheap to copy; copies share the same state.
+ */
+class CancellationToken {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class CancelReason { NONE, CANCELLED, DEADLINE };
+
+    /**
+     * Constructor
+     * -----------
+     * Creates a token that is never cancelled (use Create for a cancellable one).
+     */
+    CancellationToken() = default;
+
+    /**
+     * Create Method (Static)
+     * ----------------------
+     * Returns a new cancellable token without a deadline.
+     */
+    static CancellationToken Create() {
+        return CancellationToken(std::make_shared<State>(nullptr, Clock::time_point::max()));
+    }
+
+    /**
+     * WithDeadline Method
+     * -------------------
+     * Returns a child token that is cancelled when this token is, or once `deadline` has passed.
+     * Cancelling the child does not cancel this token.
+     */
+    CancellationToken WithDeadline(Clock::time_point deadline) const {
+        return CancellationToken(std::make_shared<State>(state, deadline));
+    }
+
+    /**
+     * Cancel Method
+     * -------------
+     * Cancels this token and all tokens derived from it. Has no effect on a default-constructed token.
+     */
+    void Cancel() const {
+        if (state) state->cancelled.store(true, std::memory_order_relaxed);
+    }
+
+    /**
+     * Returns the reason this token (or one of its ancestors) is cancelled, or NONE.
+     */
+    CancelReason Reason() const {
+        if (!state) return CancelReason::NONE;
+        bool checkClock = false;
+        for (const State* current = state.get(); current != nullptr; current = current->parent.get()) {
+            if (current->cancelled.load(std::memory_order_relaxed)) return CancelReason::CANCELLED;
+            checkClock = checkClock || current->deadline != Clock::time_point::max();
+        }
+        if (!checkClock) return CancelReason::NONE;
+        Clock::time_point now = Clock::now();
+        for (const State* current = state.get(); current != nullptr; current = current->parent.get()) {
+            if (now >= current->deadline) return CancelReason::DEADLINE;
+        }
+        return CancelReason::NONE;
+    }
+
+    /**
+     * Returns true if this token is cancelled or its deadline has passed.
+     */
+    bool IsCancelled() const { return Reason() != CancelReason::NONE; }
+
+    /**
+     * Returns false for a default-constructed token, which can never be cancelled (waits need not poll it).
+     */
+    bool CanBeCancelled() const { return state != nullptr; }
+
+private:
+    struct State {
+        State(std::shared_ptr<const State> parent, Clock::time_point deadline)
+            : parent(std::move(parent)), deadline(deadline), cancelled(false) {
+        }
+
+        std::shared_ptr<const State> parent; // Cancelling the parent cancels this state.
+        Clock::time_point deadline;          // time_point::max() when there is none.
+        std::atomic<bool> cancelled;         // Set by Cancel.
+    };
+
+    explicit CancellationToken(std::shared_ptr<State> state) : state(std::move(state)) {
+    }
+
+    std::shared_ptr<State> state; // Null for a token that can never be cancelled.
+};
+
+#endif
@@ -1,7 +1,22 @@
 #ifndef ILOADER_H
 #define ILOADER_H
 
-#include "../Core/ActionResult.h"  // Core structure for processing results.
+#include "../Core/ActionResult.h"      // Core structure for processing results.
+#include "../Core/CancellationToken.h" // Cancellation of the item being loaded.
+#include "../Core/MemoryBudget.h"      // Byte budget for loaded payloads.
+#include "../Core/Task.h"              // Coroutine task type (C++20 coroutine build only).
+#include "../Utils/TypeDetector.h"     // Fallback type detection for a single source.
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+
+/**
+ * Spare capacity reserved in every loaded item's source string, so systems that rewrite the
+ * extension in place (DecompressSystem: ".zip" -> ".json") never reallocate it.
+ */
+constexpr std::size_t kSourceHeadroom = 8;
 
 /**
  * ILoader Interface
@@ -12,6 +27,13 @@
  * Responsibilities:
  * - Declares the Load method that all loaders must implement.
  * - Provides a uniform interface for the LoaderFactory to interact with different loaders.
+ * - Lets loaders reserve memory budget before filling ActionResult::data (ReserveData).
+ * - Carries the simulated I/O latency used by loaders that stub a remote service.
+ * - Accepts a source type detected ahead of time (e.g., by a batch DetectFileTypes pass), so the
+ *   loader does not classify the source again.
+ * - Carries the cancellation token of the item being loaded, so blocking waits inside Load (budget,
+ *   simulated latency) give up once the batch is cancelled or the item's deadline passes.
+ * - In the C++20 coroutine build, declares LoadAsync, which suspends instead of blocking on I/O.
  */
 class ILoader {
 public:
@@ -36,6 +58,131 @@ public:
      * - ActionResult: The initialized ActionResult object ready for pipeline processing.
      */
     virtual ActionResult Load(const std::string& source) = 0;
+
+#ifdef COMPUTE_PIPELINE_COROUTINES
+    /**
+     * LoadAsync Method (Virtual, C++20)
+     * ---------------------------------
+     * Coroutine variant of Load. Loaders waiting on I/O override it to suspend instead of
+     * blocking a thread. The default implementation runs Load synchronously.
+     *
+     * Parameters:
+     * - source (std::string): The source string (taken by value so it outlives suspension).
+     *
+     * Returns:
+     * - Task<ActionResult>: Produces the initialized ActionResult when awaited.
+     */
+    virtual Task<ActionResult> LoadAsync(std::string source) {
+        co_return Load(source);
+    }
+#endif
+
+    /**
+     * SetSimulatedLatency Method
+     * --------------------------
+     * Sets the round-trip time that stubbed remote loaders (e.g., HttpLoader) wait per request.
+     * Zero (the default) disables the wait.
+     */
+    void SetSimulatedLatency(std::chrono::milliseconds latency) { simulatedLatency = latency; }
+
+    /**
+     * SetMemoryBudget Method
+     * ----------------------
+     * Attaches the budget that payload reservations are taken from (nullptr for no budget).
+     */
+    void SetMemoryBudget(MemoryBudget* memoryBudget) { budget = memoryBudget; }
+
+    /**
+     * SetCancellation Method
+     * ----------------------
+     * Sets the token of the item about to be loaded. Call before Load; the token is attached to the
+     * loaded item (see ReserveData) and interrupts the loader's blocking waits.
+     */
+    void SetCancellation(CancellationToken token) { cancellation = std::move(token); }
+
+    /**
+     * SetSourceType Method
+     * --------------------
+     * Sets the type of the source about to be loaded, as already detected by the caller. Without it,
+     * the loader detects the type itself (see SourceType).
+     */
+    void SetSourceType(DataType type) {
+        sourceType = type;
+        hasSourceType = true;
+    }
+
+protected:
+    /**
+     * Returns the type set with SetSourceType, or detects it from `source` when none was set.
+     */
+    DataType SourceType(const std::string& source) const {
+        return hasSourceType ? sourceType : DetectFileType(source);
+    }
+
+    /**
+     * CopySource Method
+     * -----------------
+     * Makes the item's copy of `source`, with kSourceHeadroom bytes of spare capacity. This is the
+     * only copy of the source a loader makes; the original source stays in ActionResult::source
+     * until a system rewrites it.
+     */
+    static std::string CopySource(const std::string& source) {
+        std::string copy;
+        copy.reserve(source.size() + kSourceHeadroom);
+        copy.assign(source);
+        return copy;
+    }
+
+    /**
+     * ReserveData Method
+     * ------------------
+     * Attaches the loader's cancellation token to `item` and reserves budget for a payload of `bytes`
+     * into item.dataReservation, blocking while the budget is exhausted. Call before filling item.data.
+     *
+     * Returns:
+     * - bool: false if the item was cancelled (it is then stopped, see ActionResult::StopIfCancelled,
+     *   and must not be filled), true otherwise.
+     */
+    bool ReserveData(ActionResult& item, std::size_t bytes) {
+        item.cancellation = cancellation;
+        item.dataReservation = BudgetReservation(budget, bytes, cancellation);
+        return !item.StopIfCancelled();
+    }
+
+    /**
+     * WaitSimulatedLatency Method
+     * ---------------------------
+     * Blocks for the simulated round-trip latency, in short slices so a cancellation ends the wait early.
+     *
+     * Returns:
+     * - bool: false if the wait was cut short by the cancellation token, true otherwise.
+     */
+    bool WaitSimulatedLatency() const {
+        CancellationToken::Clock::time_point end = CancellationToken::Clock::now() + simulatedLatency;
+        for (;;) {
+            if (cancellation.IsCancelled()) return false;
+            CancellationToken::Clock::time_point now = CancellationToken::Clock::now();
+            if (now >= end) return true;
+            std::this_thread::sleep_for(std::min<CancellationToken::Clock::duration>(end - now, kCancellationPollInterval));
+        }
+    }
+
+    /**
+     * Returns the simulated round-trip latency for stubbed remote loaders.
+     */
+    std::chrono::milliseconds SimulatedLatency() const { return simulatedLatency; }
+
+    /**
+     * Returns the cancellation token of the item being loaded.
+     */
+    const CancellationToken& Cancellation() const { return cancellation; }
+
+private:
+    MemoryBudget* budget = nullptr; // Budget for payloads, or nullptr.
+    std::chrono::milliseconds simulatedLatency{ 0 }; // Stubbed I/O round-trip time.
+    CancellationToken cancellation; // Token of the item being loaded (never cancelled by default).
+    DataType sourceType = DataType::UNKNOWN; // Type detected by the caller, if hasSourceType.
+    bool hasSourceType = false;              // Set by SetSourceType.
 };
 
 #endif
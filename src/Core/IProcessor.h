@@ -2,6 +2,7 @@
 #define IPROCESSOR_H
 
 #include "../Core/ActionResult.h"  // Core structure for processing results.
+#include "../Core/Task.h"          // Coroutine task type (C++20 coroutine build only).
 
 /**
  * IProcessor Interface
@@ -12,6 +13,7 @@
  * Responsibilities:
  * - Declares the Process method that all processing systems must implement.
  * - Provides a uniform interface for the PipelineManager to interact with different systems.
+ * - In the C++20 coroutine build, declares ProcessAsync, which may suspend between steps.
  */
 class IProcessor {
 public:
@@ -28,11 +30,28 @@ public:
      * -----------------------------
      * Pure virtual method that all derived processing systems must implement.
      * This method processes an ActionResult object and transforms it as needed.
+     * Long-running systems should call item.StopIfCancelled() between chunks of work and return
+     * when it reports true.
      *
      * Parameters:
      * - item (ActionResult&): A reference to the ActionResult to be processed.
      */
     virtual void Process(ActionResult& item) = 0;
+
+#ifdef COMPUTE_PIPELINE_COROUTINES
+    /**
+     * ProcessAsync Method (Virtual, C++20)
+     * ------------------------------------
+     * Coroutine variant of Process. The default implementation runs Process synchronously.
+     *
+     * Parameters:
+     * - item (ActionResult&): The item to process; it must outlive the returned task.
+     */
+    virtual Task<void> ProcessAsync(ActionResult& item) {
+        Process(item);
+        co_return;
+    }
+#endif
 };
 
 #endif
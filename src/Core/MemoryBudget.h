@@ -0,0 +1,166 @@
+#ifndef MEMORY_BUDGET_H
+#define MEMORY_BUDGET_H
+
+#include "../Core/CancellationToken.h" // Lets a blocked reservation give up.
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+/**
+ * MemoryBudget Class
+ * ------------------
+ * Global byte budget for item payloads (ActionResult::data).
+ * Loaders reserve budget before filling a payload and block while the budget is exhausted,
+ * so loading cannot run arbitrarily far ahead of processing.
+ *
+ * Responsibilities:
+ * - Tracks the bytes currently reserved and the peak reservation (gauges); ResetPeak starts a new
+ *   measurement window, e.g., per executor run.
+ * - Blocks Reserve calls until enough budget is released, or until the caller's token is cancelled.
+ * - Admits a single reservation larger than the whole limit when nothing else is reserved,
+ *   so an oversized item slows the pipeline down instead of deadlocking it.
+ * - A limit of 0 means unlimited (reservations are only counted).
+ */
+class MemoryBudget {
+public:
+    /**
+     * Constructor
+     * -----------
+     * Parameters:
+     * - limitBytes (std::size_t): Maximum reserved bytes, or 0 for no limit.
+     */
+    explicit MemoryBudget(std::size_t limitBytes = 0)
+        : limit(limitBytes), current(0), peak(0), waits(0) {
+    }
+
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+    /**
+     * Reserve Method
+     * --------------
+     * Reserves `bytes`, blocking until they fit into the budget.
+     *
+     * Parameters:
+     * - bytes (std::size_t): Bytes to reserve.
+     * - cancel (const CancellationToken&): Stops waiting once cancelled (checked every kCancellationPollInterval).
+     *
+     * Returns:
+     * - bool: false if `cancel` was cancelled while waiting (nothing is reserved), true otherwise.
+     */
+    bool Reserve(std::size_t bytes, const CancellationToken& cancel = CancellationToken()) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!Fits(bytes)) {
+            ++waits;
+            while (!Fits(bytes)) {
+                if (cancel.IsCancelled()) return false;
+                released.wait_for(lock, kCancellationPollInterval);
+            }
+        }
+        current += bytes;
+        if (current > peak) peak = current;
+        return true;
+    }
+
+    /**
+     * Release Method
+     * --------------
+     * Returns `bytes` to the budget and wakes blocked reservations.
+     */
+    void Release(std::size_t bytes) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            current -= bytes < current ? bytes : current;
+        }
+        released.notify_all();
+    }
+
+    /**
+     * ResetPeak Method
+     * ----------------
+     * Restarts peak tracking from the bytes reserved right now.
+     */
+    void ResetPeak() {
+        std::lock_guard<std::mutex> lock(mutex);
+        peak = current;
+    }
+
+    std::size_t LimitBytes() const { return limit; }
+    std::size_t CurrentBytes() const { std::lock_guard<std::mutex> lock(mutex); return current; }
+    std::size_t PeakBytes() const { std::lock_guard<std::mutex> lock(mutex); return peak; }
+    std::size_t WaitCount() const { std::lock_guard<std::mutex> lock(mutex); return waits; }
+
+private:
+    bool Fits(std::size_t bytes) const {
+        return limit == 0 || current == 0 || current + bytes <= limit;
+    }
+
+    const std::size_t limit;             // Maximum reserved bytes (0 = unlimited).
+    std::size_t current;                 // Bytes currently reserved.
+    std::size_t peak;                    // Highest value of current so far.
+    std::size_t waits;                   // Reservations that had to wait.
+    mutable std::mutex mutex;            // Guards the counters above.
+    std::condition_variable released;    // Signalled whenever budget is released.
+};
+
+/**
+ * BudgetReservation Class
+ * -----------------------
+ * Move-only handle to bytes reserved from a MemoryBudget; the bytes are released when the
+ * handle is released, reassigned or destroyed. An empty handle (no budget) does nothing.
+ */
+class BudgetReservation {
+public:
+    BudgetReservation() : budget(nullptr), bytes(0) {
+    }
+
+    /**
+     * Reserves `bytes` from `budget` (blocking until they fit or `cancel` is cancelled).
+     * A null budget, or a wait given up on cancellation, produces an empty handle.
+     */
+    BudgetReservation(MemoryBudget* budget, std::size_t bytes, const CancellationToken& cancel = CancellationToken())
+        : budget(budget), bytes(budget ? bytes : 0) {
+        if (budget && !budget->Reserve(bytes, cancel)) {
+            this->budget = nullptr;
+            this->bytes = 0;
+        }
+    }
+
+    BudgetReservation(BudgetReservation&& other) : budget(other.budget), bytes(other.bytes) {
+        other.budget = nullptr;
+        other.bytes = 0;
+    }
+
+    BudgetReservation& operator=(BudgetReservation&& other) {
+        if (this != &other) {
+            Release();
+            budget = other.budget;
+            bytes = other.bytes;
+            other.budget = nullptr;
+            other.bytes = 0;
+        }
+        return *this;
+    }
+
+    BudgetReservation(const BudgetReservation&) = delete;
+    BudgetReservation& operator=(const BudgetReservation&) = delete;
+
+    ~BudgetReservation() { Release(); }
+
+    /**
+     * Returns the reserved bytes to the budget.
+     */
+    void Release() {
+        if (budget) budget->Release(bytes);
+        budget = nullptr;
+        bytes = 0;
+    }
+
+    std::size_t Bytes() const { return bytes; }
+
+private:
+    MemoryBudget* budget; // Budget the bytes came from, or nullptr.
+    std::size_t bytes;    // Reserved bytes.
+};
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef STRING_REF_H
+#define STRING_REF_H
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <utility>
+
+/**
+ * StringRef Class
+ * ---------------
+ * Lightweight string holder used by ActionResult for values that are almost always constant
+ * (protocol names, content descriptions such as "Initial File Content" or "Decoded Image").
+ *
+ * Responsibilities:
+ * - References a static string literal directly, without allocating or copying it. Literals are
+ *   wrapped with the _sr suffix (e.g., "Decoded Image"_sr); a literal operator is only ever invoked
+ *   on genuine string literals, so stack buffers cannot be referenced by mistake.
+ * - Owns a std::string when the value is only known at runtime (e.g., restored from disk).
+ * - Exposes a read-only view (c_str, size, str) and comparison against C strings.
+ */
+class StringRef {
+public:
+    /**
+     * Default Constructor
+     * -------------------
+     * Initializes an empty value that references the static empty literal.
+     */
+    StringRef() : literal(""), length(0) {
+    }
+
+    /**
+     * Owning Constructor (Explicit)
+     * -----------------------------
+     * Takes ownership of a runtime string. Explicit so that owned copies are always visible at the call site.
+     *
+     * Parameters:
+     * - value (std::string): The string to own (moved in).
+     */
+    explicit StringRef(std::string value) : literal(nullptr), length(0), owned(std::move(value)) {
+    }
+
+    /**
+     * Returns a null-terminated pointer to the value.
+     */
+    const char* c_str() const { return literal ? literal : owned.c_str(); }
+
+    /**
+     * Returns the length of the value in bytes.
+     */
+    std::size_t size() const { return literal ? length : owned.size(); }
+
+    /**
+     * Returns true when the value references a static literal rather than an owned string.
+     */
+    bool IsStatic() const { return literal != nullptr; }
+
+    /**
+     * Returns the value as a new std::string (this always allocates; avoid on hot paths).
+     */
+    std::string str() const { return std::string(c_str(), size()); }
+
+    bool operator==(const char* other) const { return std::strcmp(c_str(), other) == 0; }
+    bool operator!=(const char* other) const { return !(*this == other); }
+
+private:
+    friend StringRef operator"" _sr(const char* value, std::size_t size);
+
+    // Literal constructor, reachable only through the _sr literal operator.
+    struct LiteralTag {};
+    StringRef(LiteralTag, const char* value, std::size_t size) : literal(value), length(size) {
+    }
+
+    const char* literal; // Static literal, or nullptr when the value is owned.
+    std::size_t length;  // Length of the literal (unused when the value is owned).
+    std::string owned;   // Owned value, used only when literal is nullptr.
+};
+
+/**
+ * Literal Operator
+ * ----------------
+ * Wraps a string literal in a StringRef: "http"_sr. Only the pointer and length are stored.
+ */
+inline StringRef operator"" _sr(const char* value, std::size_t size) {
+    return StringRef(StringRef::LiteralTag(), value, size);
+}
+
+/**
+ * Streams the value without materializing a std::string.
+ */
+inline std::ostream& operator<<(std::ostream& os, const StringRef& value) {
+    return os.write(value.c_str(), static_cast<std::streamsize>(value.size()));
+}
+
+#endif
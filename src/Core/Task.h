@@ -0,0 +1,161 @@
+#ifndef TASK_H
+#define TASK_H
+
+#ifdef COMPUTE_PIPELINE_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+/**
+ * Task Utility (C++20)
+ * --------------------
+ * Minimal lazy coroutine types used by the coroutine build (COMPUTE_PIPELINE_COROUTINES).
+ *
+ * - Task<T>:      A coroutine producing a T. It starts when awaited and resumes its awaiter when done
+ *                 (symmetric transfer, so long chains do not grow the stack).
+ * - Task<void>:   Same, without a value.
+ * - DetachedTask: A top-level coroutine started explicitly through its handle (e.g., posted to a
+ *                 CoroutineScheduler); its frame is destroyed automatically when it finishes.
+ */
+
+namespace TaskDetail {
+
+// Resumes the awaiting coroutine (if any) when a Task finishes.
+struct FinalAwaiter {
+    bool await_ready() const noexcept { return false; }
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> finished) noexcept {
+        std::coroutine_handle<> continuation = finished.promise().continuation;
+        return continuation ? continuation : std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept {}
+};
+
+struct PromiseBase {
+    std::coroutine_handle<> continuation; // Coroutine awaiting this task.
+    std::exception_ptr exception;         // Exception thrown by the task body, if any.
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() noexcept { exception = std::current_exception(); }
+};
+
+} // namespace TaskDetail
+
+template <typename T>
+class Task {
+public:
+    struct promise_type : TaskDetail::PromiseBase {
+        std::optional<T> value;
+
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+        template <typename U>
+        void return_value(U&& result) { value.emplace(std::forward<U>(result)); }
+    };
+
+    Task(Task&& other) noexcept : handle(std::exchange(other.handle, {})) {
+    }
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle) handle.destroy();
+            handle = std::exchange(other.handle, {});
+        }
+        return *this;
+    }
+
+    ~Task() {
+        if (handle) handle.destroy();
+    }
+
+    // Awaiting a Task starts it and suspends the awaiter until it finishes.
+    bool await_ready() const noexcept { return false; }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle.promise().continuation = awaiting;
+        return handle;
+    }
+
+    T await_resume() {
+        if (handle.promise().exception) std::rethrow_exception(handle.promise().exception);
+        return std::move(*handle.promise().value);
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle(handle) {
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+template <>
+class Task<void> {
+public:
+    struct promise_type : TaskDetail::PromiseBase {
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        void return_void() {}
+    };
+
+    Task(Task&& other) noexcept : handle(std::exchange(other.handle, {})) {
+    }
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle) handle.destroy();
+            handle = std::exchange(other.handle, {});
+        }
+        return *this;
+    }
+
+    ~Task() {
+        if (handle) handle.destroy();
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        handle.promise().continuation = awaiting;
+        return handle;
+    }
+
+    void await_resume() {
+        if (handle.promise().exception) std::rethrow_exception(handle.promise().exception);
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle(handle) {
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+class DetachedTask {
+public:
+    struct promise_type {
+        DetachedTask get_return_object() { return DetachedTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    /**
+     * Returns the handle used to start the coroutine (it has not run yet).
+     */
+    std::coroutine_handle<> Handle() const { return handle; }
+
+private:
+    explicit DetachedTask(std::coroutine_handle<promise_type> handle) : handle(handle) {
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+#endif // COMPUTE_PIPELINE_COROUTINES
+
+#endif
@@ -5,6 +5,7 @@
 #include "../Loaders/FileLoader.h"      // Loader for file:// protocol.
 #include "../Loaders/HttpLoader.h"      // Loader for http:// and https:// protocols.
 #include "../Loaders/BundleLoader.h"    // Loader for bundle:// protocol.
+#include "../Utils/SchemeDetector.h"    // Protocol prefix detection (single and batch).
 #include <memory>
 #include <iostream>
 
@@ -43,20 +44,37 @@ public:
      * - nullptr if no suitable Loader is found.
      */
     static std::unique_ptr<ILoader> CreateLoader(const std::string& source) {
-        // Check for file:// protocol and return FileLoader.
-        if (source.find("file://") == 0) {
+        return CreateLoader(DetectScheme(source), source);
+    }
+
+    /**
+     * CreateLoader Method (Static, Pre-classified)
+     * --------------------------------------------
+     * Creates a Loader for a scheme that was already detected, e.g. by classifying a whole
+     * input list up front with DetectSchemes (see SchemeDetector.h).
+     *
+     * Parameters:
+     * - scheme (SourceScheme): The detected scheme of the source.
+     * - source (const std::string&): The source string, used for error reporting.
+     *
+     * Returns:
+     * - std::unique_ptr<ILoader>: A unique pointer to the appropriate Loader.
+     * - nullptr if no suitable Loader is found.
+     */
+    static std::unique_ptr<ILoader> CreateLoader(SourceScheme scheme, const std::string& source) {
+        switch (scheme) {
+        // file:// protocol uses FileLoader.
+        case SourceScheme::FILE:
             return std::make_unique<FileLoader>();
-        }
-        // Check for http:// or https:// protocols and return HttpLoader.
-        else if (source.find("http://") == 0 || source.find("https://") == 0) {
+        // http:// and https:// protocols use HttpLoader.
+        case SourceScheme::HTTP:
+        case SourceScheme::HTTPS:
             return std::make_unique<HttpLoader>();
-        }
-        // Check for bundle:// protocol and return BundleLoader.
-        else if (source.find("bundle://") == 0) {
+        // bundle:// protocol uses BundleLoader.
+        case SourceScheme::BUNDLE:
             return std::make_unique<BundleLoader>();
-        }
         // If no known protocol is detected, log an error and return nullptr.
-        else {
+        default:
             std::cerr << "Unknown protocol: " << source << "\n";
             return nullptr;
         }
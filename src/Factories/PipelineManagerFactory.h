@@ -6,7 +6,11 @@
 #include "../Systems/DecodeImageSystem.h"    // System for decoding image files.
 #include "../Systems/ParseJsonSystem.h"      // System for parsing JSON files.
 #include "../Systems/UnknownFileSystem.h"    // System for handling unknown file types.
+#include "../Systems/PipelineExecutor.h"     // Multi-threaded executor for compiled stage graphs.
+#include "../Utils/PipelineConfig.h"         // Stage graph configuration and validation.
 #include <memory>
+#include <string>
+#include <vector>
 
 /**
  * PipelineManagerFactory Class
@@ -20,19 +24,105 @@
  * - Ensures modularity and extensibility by allowing easy addition of new processors.
  *
  * Methods:
- * - CreatePipelineManager: Instantiates and configures a PipelineManager with predefined processors.
+ * - CreateProcessor: Creates a processing system from its registered name.
+ * - CompilePipeline: Validates a PipelineConfig and compiles it into a flat dispatch table.
+ * - CreatePipelineManager: Instantiates and configures a PipelineManager from a compiled pipeline.
+ * - CreatePipelineExecutor: Instantiates a multi-threaded executor for a compiled pipeline.
  */
 class PipelineManagerFactory {
 public:
+    /**
+     * CreateProcessor Method (Static)
+     * -------------------------------
+     * Creates a processing system from the name used in pipeline configuration files.
+     *
+     * Parameters:
+     * - name (const std::string&): The processor name (e.g., "DecompressSystem").
+     *
+     * Returns:
+     * - std::unique_ptr<IProcessor>: The new processor, or nullptr if the name is unknown.
+     */
+    static std::unique_ptr<IProcessor> CreateProcessor(const std::string& name) {
+        if (name == "DecompressSystem")  return std::make_unique<DecompressSystem>();
+        if (name == "DecodeImageSystem") return std::make_unique<DecodeImageSystem>();
+        if (name == "ParseJsonSystem")   return std::make_unique<ParseJsonSystem>();
+        if (name == "UnknownFileSystem") return std::make_unique<UnknownFileSystem>();
+        return nullptr;
+    }
+
+    /**
+     * CompilePipeline Method (Static)
+     * -------------------------------
+     * Validates a pipeline configuration and compiles it into a flat dispatch table
+     * (DataType -> stage index) with each stage's processor resolved to a factory function.
+     *
+     * Parameters:
+     * - config (const PipelineConfig&): The configuration to compile.
+     * - compiled (CompiledPipeline&): Receives the compiled pipeline.
+     * - errors (std::vector<std::string>&): Receives one message per problem found.
+     *
+     * Returns:
+     * - bool: true if the configuration is valid and was compiled.
+     */
+    static bool CompilePipeline(const PipelineConfig& config, CompiledPipeline& compiled,
+                                std::vector<std::string>& errors) {
+        std::size_t errorCount = errors.size();
+        ValidatePipelineConfig(config, errors);
+        for (const StageConfig& stage : config.stages) {
+            if (!stage.processor.empty() && CreateProcessor(stage.processor) == nullptr) {
+                errors.push_back("stage '" + stage.name + "' uses unknown processor '" + stage.processor + "'");
+            }
+        }
+        if (errors.size() != errorCount) return false;
+
+        compiled = CompiledPipeline();
+        compiled.loaderThreads = config.loaderThreads;
+        compiled.loaderQueueDepth = config.loaderQueueDepth;
+        compiled.httpLatencyMs = config.httpLatencyMs;
+        compiled.memoryLimitBytes = config.memoryLimitBytes;
+        compiled.pinThreads = config.pinThreads;
+        compiled.itemTimeoutMs = config.itemTimeoutMs;
+        compiled.batchTimeoutMs = config.batchTimeoutMs;
+        for (std::size_t i = 0; i < config.stages.size(); ++i) {
+            const StageConfig& stage = config.stages[i];
+            std::string processorName = stage.processor;
+            compiled.stages.push_back(CompiledStage{ stage, [processorName] { return CreateProcessor(processorName); } });
+            for (DataType type : stage.accepts) {
+                compiled.dispatch[static_cast<std::size_t>(type)] = static_cast<int>(i);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * CreatePipelineManager Method (Static)
+     * -------------------------------------
+     * Creates a sequential PipelineManager from a compiled pipeline.
+     * Each stage registers one processor instance for every DataType it accepts.
+     *
+     * Parameters:
+     * - pipeline (const CompiledPipeline&): The compiled pipeline.
+     *
+     * Returns:
+     * - std::unique_ptr<PipelineManager>: A fully configured PipelineManager ready for processing.
+     */
+    static std::unique_ptr<PipelineManager> CreatePipelineManager(const CompiledPipeline& pipeline) {
+        auto manager = std::make_unique<PipelineManager>();
+        for (const CompiledStage& stage : pipeline.stages) {
+            for (DataType type : stage.config.accepts) {
+                manager->RegisterProcessor(type, stage.createProcessor());
+            }
+        }
+        return manager;
+    }
+
     /**
      * CreatePipelineManager Method (Static)
      * -------------------------------------
-     * Creates and configures a PipelineManager instance with predefined processing systems.
-     * This method ensures that the pipeline is ready for processing different data types.
+     * Creates and configures a PipelineManager instance from the built-in default configuration.
      *
      * Workflow:
-     * - Instantiates a PipelineManager.
-     * - Registers various processing systems dynamically:
+     * - Compiles PipelineConfig::Default(), which registers:
      *     - DecompressSystem -> Handles compressed files (.zip).
      *     - DecodeImageSystem -> Handles image decoding (.jpg).
      *     - ParseJsonSystem -> Handles JSON parsing (.json).
@@ -43,12 +133,25 @@ public:
      * - std::unique_ptr<PipelineManager>: A fully configured PipelineManager ready for processing.
      */
     static std::unique_ptr<PipelineManager> CreatePipelineManager() {
-        auto pipeline = std::make_unique<PipelineManager>();
-        pipeline->RegisterProcessor(DataType::COMPRESSED, std::make_unique<DecompressSystem>());
-        pipeline->RegisterProcessor(DataType::IMAGE, std::make_unique<DecodeImageSystem>());
-        pipeline->RegisterProcessor(DataType::JSON, std::make_unique<ParseJsonSystem>());
-        pipeline->RegisterProcessor(DataType::UNKNOWN, std::make_unique<UnknownFileSystem>());
-        return pipeline;
+        CompiledPipeline pipeline;
+        std::vector<std::string> errors;
+        CompilePipeline(PipelineConfig::Default(), pipeline, errors);
+        return CreatePipelineManager(pipeline);
+    }
+
+    /**
+     * CreatePipelineExecutor Method (Static)
+     * --------------------------------------
+     * Creates a multi-threaded executor that runs each stage on its own worker pool.
+     *
+     * Parameters:
+     * - pipeline (const CompiledPipeline&): The compiled pipeline.
+     *
+     * Returns:
+     * - std::unique_ptr<PipelineExecutor>: The executor, ready to Run a batch of sources.
+     */
+    static std::unique_ptr<PipelineExecutor> CreatePipelineExecutor(const CompiledPipeline& pipeline) {
+        return std::make_unique<PipelineExecutor>(pipeline);
     }
 };
 
@@ -35,24 +35,19 @@ public:
         // Log the loading action.
         std::cout << "Loading data from Bundle: " << source << "\n";
 
-        // Detect the file type using the TypeDetector utility.
-        DataType type = DetectFileType(source);
-
-        // Identify the protocol as "bundle".
-        std::string protocol = "bundle";
-
-        // Initialize the content description for bundles.
-        std::string content = "Initial Bundle Content";
+        // Use the type detected in batch by the executor, or detect it with the TypeDetector utility.
+        DataType type = SourceType(source);
 
         // Create the ActionResult object.
-        ActionResult item(type, source, protocol, content);
+        // Protocol ("bundle") and content description reference static literals, so only the source is copied.
+        ActionResult item(type, CopySource(source), "bundle"_sr, "Initial Bundle Content"_sr);
 
         // Add metadata specific to bundles.
         item.metadata["Loaded From"] = "Bundle";
-        item.metadata["Source Path"] = source;
 
         // Simulate loading bundle data.
-        item.data = std::vector<char>(300, 'Z'); // Placeholder 300 bytes of 'Z'.
+        // Reserve memory budget for the payload before allocating it (may block; a cancelled item stays empty).
+        if (ReserveData(item, 300)) item.data = std::vector<char>(300, 'Z'); // Placeholder 300 bytes of 'Z'.
 
         // Return the initialized ActionResult.
         return item;
@@ -35,24 +35,19 @@ public:
         // Log the loading action.
         std::cout << "Loading file: " << source << "\n";
 
-        // Detect the file type using the TypeDetector utility.
-        DataType type = DetectFileType(source);
-
-        // Identify the protocol as "file".
-        std::string protocol = "file";
-
-        // Initialize the content description for files.
-        std::string content = "Initial File Content";
+        // Use the type detected in batch by the executor, or detect it with the TypeDetector utility.
+        DataType type = SourceType(source);
 
         // Create the ActionResult object.
-        ActionResult item(type, source, protocol, content);
+        // Protocol ("file") and content description reference static literals, so only the source is copied.
+        ActionResult item(type, CopySource(source), "file"_sr, "Initial File Content"_sr);
 
         // Add metadata specific to local files.
         item.metadata["Loaded From"] = "File System";
-        item.metadata["Source Path"] = source;
 
         // Simulate loading file data.
-        item.data = std::vector<char>(100, 'X'); // Placeholder 100 bytes of 'X'.
+        // Reserve memory budget for the payload before allocating it (may block; a cancelled item stays empty).
+        if (ReserveData(item, 100)) item.data = std::vector<char>(100, 'X'); // Placeholder 100 bytes of 'X'.
 
         // Return the initialized ActionResult.
         return item;
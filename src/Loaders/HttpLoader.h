@@ -3,6 +3,7 @@
 
 #include "../Core/ILoader.h"         // Interface for all loaders.
 #include "../Utils/TypeDetector.h"   // Utility for detecting file types.
+#include "../Utils/CoroutineScheduler.h" // Non-blocking waits (C++20 coroutine build only).
 #include <iostream>
 
 /**
@@ -16,6 +17,8 @@
  * - Identifies the protocol (http or https).
  * - Initializes the ActionResult with the content and metadata for URLs.
  * - Simulates data loading for test purposes.
+ * - Stubs the network round trip with the loader's simulated latency (zero by default); a cancelled
+ *   item stops waiting and is returned without a payload.
  */
 class HttpLoader : public ILoader {
 public:
@@ -32,27 +35,66 @@ public:
      * - ActionResult: The initialized ActionResult object ready for pipeline processing.
      */
     ActionResult Load(const std::string& source) override {
-        // Log the loading action.
-        std::cout << "Loading data from URL: " << source << "\n";
+        // Simulate the network round trip by blocking the calling thread, unless the item is cancelled first.
+        if (!WaitSimulatedLatency()) return StoppedItem(source);
+        return CreateItem(source);
+    }
+
+#ifdef COMPUTE_PIPELINE_COROUTINES
+    /**
+     * LoadAsync Method (Override, C++20)
+     * ----------------------------------
+     * Same as Load, but the simulated network round trip suspends the coroutine instead of
+     * blocking its thread, so many requests can wait concurrently on a few threads. The wait is
+     * skipped or cut short once the item is cancelled.
+     */
+    Task<ActionResult> LoadAsync(std::string source) override {
+        // A named awaiter, not a temporary (see SleepFor).
+        SleepFor roundTrip{ SimulatedLatency(), Cancellation() };
+        if (!Cancellation().IsCancelled()) co_await roundTrip;
+        if (Cancellation().IsCancelled()) co_return StoppedItem(source);
+        co_return CreateItem(source);
+    }
+#endif
+
+private:
+    /**
+     * Identifies the protocol (http or https). Both are static literals, so nothing is allocated.
+     */
+    static StringRef Protocol(const std::string& source) {
+        return source.find("https://") == 0 ? "https"_sr : "http"_sr;
+    }
 
-        // Detect the file type using the TypeDetector utility.
-        DataType type = DetectFileType(source);
+    /**
+     * Builds the empty, stopped ActionResult of an item cancelled before its response arrived.
+     */
+    ActionResult StoppedItem(const std::string& source) const {
+        ActionResult item(SourceType(source), source, Protocol(source), "Not Loaded"_sr);
+        item.cancellation = Cancellation();
+        item.StopIfCancelled();
+        return item;
+    }
 
-        // Identify the protocol (http or https).
-        std::string protocol = (source.find("https://") == 0) ? "https" : "http";
+    /**
+     * Builds the ActionResult for a URL once its (simulated) response has arrived.
+     */
+    ActionResult CreateItem(const std::string& source) {
+        // Log the loading action.
+        std::cout << "Loading data from URL: " << source << "\n";
 
-        // Initialize the content description for URLs.
-        std::string content = "Initial URL Content";
+        // Use the type detected in batch by the executor, or detect it with the TypeDetector utility.
+        DataType type = SourceType(source);
 
         // Create the ActionResult object.
-        ActionResult item(type, source, protocol, content);
+        // Protocol and content description reference static literals, so only the source is copied.
+        ActionResult item(type, CopySource(source), Protocol(source), "Initial URL Content"_sr);
 
         // Add metadata specific to URLs.
         item.metadata["Loaded From"] = "URL";
-        item.metadata["Source Path"] = source;
 
         // Simulate loading URL data.
-        item.data = std::vector<char>(200, 'Y'); // Placeholder 200 bytes of 'Y'.
+        // Reserve memory budget for the payload before allocating it (may block; a cancelled item stays empty).
+        if (ReserveData(item, 200)) item.data = std::vector<char>(200, 'Y'); // Placeholder 200 bytes of 'Y'.
 
         // Return the initialized ActionResult.
         return item;
@@ -0,0 +1,220 @@
+#ifndef RESULT_COLUMN_READER_H
+#define RESULT_COLUMN_READER_H
+
+#include "../Core/ActionResult.h"    // DataType.
+#include "../Sinks/ResultColumns.h"  // Binary layout of the columnar result file.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * ColumnString Struct
+ * -------------------
+ * Non-owning view of a string stored inside a mapped result file.
+ */
+struct ColumnString {
+    const char* data;
+    std::size_t size;
+
+    std::string str() const { return std::string(data, size); }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const ColumnString& value) {
+    return os.write(value.data, static_cast<std::streamsize>(value.size));
+}
+
+/**
+ * ResultColumnReader Class
+ * ------------------------
+ * Memory-maps a columnar result file written by ResultColumnWriter and exposes its columns in place.
+ *
+ * Responsibilities:
+ * - Maps the file read-only and validates the header, section bounds, offset tables and dictionary ids.
+ * - Returns rows and raw columns as pointers into the mapping (no parsing, no copies).
+ * - Unmaps the file on destruction; views returned by the reader are valid until then.
+ */
+class ResultColumnReader {
+public:
+    ResultColumnReader() : base(nullptr), size(0), header(nullptr) {
+    }
+
+    ~ResultColumnReader() { Close(); }
+
+    ResultColumnReader(const ResultColumnReader&) = delete;
+    ResultColumnReader& operator=(const ResultColumnReader&) = delete;
+
+    /**
+     * Open Method
+     * -----------
+     * Maps the given file.
+     *
+     * Returns:
+     * - bool: true if the file was mapped and is a valid result file; otherwise an error is logged.
+     */
+    bool Open(const std::string& path) {
+        Close();
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::cerr << "Cannot open result file: " << path << "\n";
+            return false;
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(ResultColumnsHeader)) {
+            std::cerr << "Invalid result file: " << path << "\n";
+            ::close(fd);
+            return false;
+        }
+        size = static_cast<std::size_t>(info.st_size);
+        void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) {
+            std::cerr << "Cannot map result file: " << path << "\n";
+            size = 0;
+            return false;
+        }
+        base = static_cast<const char*>(mapped);
+        header = reinterpret_cast<const ResultColumnsHeader*>(base);
+        if (!Validate()) {
+            std::cerr << "Invalid result file: " << path << "\n";
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Close Method
+     * ------------
+     * Unmaps the file. Called automatically by the destructor.
+     */
+    void Close() {
+        if (base != nullptr) ::munmap(const_cast<char*>(base), size);
+        base = nullptr;
+        header = nullptr;
+        size = 0;
+    }
+
+    std::size_t RowCount() const { return header ? header->rowCount : 0; }
+    std::size_t DictionarySize() const { return header ? header->dictCount : 0; }
+
+    // Row accessors.
+    ColumnString Source(std::size_t row) const {
+        const std::uint64_t* offsets = Column<std::uint64_t>(header->sourceOffsets);
+        return ColumnString{ base + header->sourceBytes + offsets[row], offsets[row + 1] - offsets[row] };
+    }
+    DataType Type(std::size_t row) const { return static_cast<DataType>(TypeColumn()[row]); }
+    bool IsProcessed(std::size_t row) const { return (StatusColumn()[row] & RESULT_STATUS_PROCESSED) != 0; }
+    ColumnString Protocol(std::size_t row) const { return DictionaryEntry(ProtocolColumn()[row]); }
+    ColumnString Content(std::size_t row) const { return DictionaryEntry(ContentColumn()[row]); }
+
+    std::size_t MetadataCount(std::size_t row) const {
+        const std::uint64_t* offsets = Column<std::uint64_t>(header->metaOffsets);
+        return offsets[row + 1] - offsets[row];
+    }
+    ColumnString MetadataKey(std::size_t row, std::size_t index) const { return DictionaryEntry(MetaPair(row, index)[0]); }
+    ColumnString MetadataValue(std::size_t row, std::size_t index) const { return DictionaryEntry(MetaPair(row, index)[1]); }
+
+    // Raw columns, for scans over a single field.
+    const std::uint8_t* TypeColumn() const { return Column<std::uint8_t>(header->types); }
+    const std::uint8_t* StatusColumn() const { return Column<std::uint8_t>(header->statuses); }
+    const std::uint32_t* ProtocolColumn() const { return Column<std::uint32_t>(header->protocols); }
+    const std::uint32_t* ContentColumn() const { return Column<std::uint32_t>(header->contents); }
+
+    ColumnString DictionaryEntry(std::uint32_t id) const {
+        const std::uint64_t* offsets = Column<std::uint64_t>(header->dictOffsets);
+        return ColumnString{ base + header->dictBytes + offsets[id], offsets[id + 1] - offsets[id] };
+    }
+
+private:
+    template <typename T>
+    const T* Column(std::uint64_t offset) const { return reinterpret_cast<const T*>(base + offset); }
+
+    const std::uint32_t* MetaPair(std::size_t row, std::size_t index) const {
+        const std::uint64_t* offsets = Column<std::uint64_t>(header->metaOffsets);
+        return Column<std::uint32_t>(header->metaPairs) + 2 * (offsets[row] + index);
+    }
+
+    // Checks the magic and version, that the sections follow each other in layout order inside the
+    // file, that every offset table and dictionary id stays inside its section and that every type is a
+    // DataType. These columns are scanned once here so that the accessors need no further checks.
+    bool Validate() const {
+        if (std::memcmp(header->magic, kResultColumnsMagic, sizeof(header->magic)) != 0) return false;
+        if (header->version != kResultColumnsVersion || header->fileSize != size) return false;
+
+        // A valid file holds at least one byte per row and eight per pair or dictionary entry, so larger
+        // counts are corrupt; rejecting them also keeps the section sizes below from overflowing.
+        std::uint64_t rows = header->rowCount;
+        std::uint64_t pairs = header->metaPairCount;
+        std::uint64_t dictCount = header->dictCount;
+        if (rows > size || pairs > size || dictCount > size) return false;
+
+        // The blobs (sourceBytes, dictBytes) have no size of their own: they end where the next section starts.
+        struct Section { std::uint64_t offset; std::uint64_t bytes; } sections[] = {
+            { header->sourceOffsets, (rows + 1) * sizeof(std::uint64_t) },
+            { header->sourceBytes, 0 },
+            { header->types, rows },
+            { header->statuses, rows },
+            { header->protocols, rows * sizeof(std::uint32_t) },
+            { header->contents, rows * sizeof(std::uint32_t) },
+            { header->metaOffsets, (rows + 1) * sizeof(std::uint64_t) },
+            { header->metaPairs, pairs * 2 * sizeof(std::uint32_t) },
+            { header->dictOffsets, (dictCount + 1) * sizeof(std::uint64_t) },
+            { header->dictBytes, 0 },
+        };
+        std::uint64_t end = sizeof(ResultColumnsHeader);
+        for (const Section& section : sections) {
+            if (section.offset < end || section.offset % 8 != 0 || section.offset > size ||
+                section.bytes > size - section.offset) {
+                return false;
+            }
+            end = section.offset + section.bytes;
+        }
+
+        return Monotonic(header->sourceOffsets, rows, header->types - header->sourceBytes) &&
+               Monotonic(header->metaOffsets, rows, pairs) &&
+               Monotonic(header->dictOffsets, dictCount, size - header->dictBytes) &&
+               IdsBelow(header->protocols, rows, dictCount) &&
+               IdsBelow(header->contents, rows, dictCount) &&
+               IdsBelow(header->metaPairs, pairs * 2, dictCount) &&
+               TypesValid(rows);
+    }
+
+    // Checks that the `count + 1` offsets at `table` never decrease and that the last is at most `limit`.
+    bool Monotonic(std::uint64_t table, std::uint64_t count, std::uint64_t limit) const {
+        const std::uint64_t* offsets = Column<std::uint64_t>(table);
+        for (std::uint64_t i = 0; i < count; ++i) {
+            if (offsets[i] > offsets[i + 1]) return false;
+        }
+        return offsets[count] <= limit;
+    }
+
+    // Checks that the `count` dictionary ids at `column` are below `dictCount`.
+    bool IdsBelow(std::uint64_t column, std::uint64_t count, std::uint64_t dictCount) const {
+        const std::uint32_t* ids = Column<std::uint32_t>(column);
+        for (std::uint64_t i = 0; i < count; ++i) {
+            if (ids[i] >= dictCount) return false;
+        }
+        return true;
+    }
+
+    // Checks that the `rows` bytes of the types column are DataType values.
+    bool TypesValid(std::uint64_t rows) const {
+        const std::uint8_t* types = TypeColumn();
+        for (std::uint64_t i = 0; i < rows; ++i) {
+            if (types[i] >= kDataTypeCount) return false;
+        }
+        return true;
+    }
+
+    const char* base;                   // Start of the mapping, or nullptr.
+    std::size_t size;                   // Mapping size in bytes.
+    const ResultColumnsHeader* header;  // Header at the start of the mapping.
+};
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef RESULT_COLUMN_WRITER_H
+#define RESULT_COLUMN_WRITER_H
+
+#include "../Core/ActionResult.h"    // Core structure for processing results.
+#include "../Sinks/ResultColumns.h"  // Binary layout of the columnar result file.
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * ResultColumnWriter Class
+ * ------------------------
+ * Collects processed ActionResults into columns and writes them to a binary file (see ResultColumns.h).
+ *
+ * Responsibilities:
+ * - Appends each result to in-memory columns (sources, type, status, protocol, content, metadata).
+ * - Dictionary-encodes protocols, contents and metadata keys/values, which repeat across results.
+ * - Writes the file in one step: the file is sized up front, memory-mapped, and every column is copied in.
+ * - Replaces the target atomically: the columns go to a uniquely named temporary file next to `path`
+ *   (`path.XXXXXX`, created with mkstemp), which is renamed over `path` once flushed, so readers never
+ *   map a truncated or half-written file and concurrent writers never share a temporary file.
+ */
+class ResultColumnWriter {
+public:
+    ResultColumnWriter() {
+        sourceOffsets.push_back(0);
+        metaOffsets.push_back(0);
+        dictOffsets.push_back(0);
+    }
+
+    /**
+     * Append Method
+     * -------------
+     * Adds one result as a new row.
+     *
+     * Parameters:
+     * - item (const ActionResult&): The processed item.
+     */
+    void Append(const ActionResult& item) {
+        sourceBytes.insert(sourceBytes.end(), item.source.begin(), item.source.end());
+        sourceOffsets.push_back(sourceBytes.size());
+        types.push_back(static_cast<std::uint8_t>(item.type));
+        statuses.push_back(item.isProcessed ? RESULT_STATUS_PROCESSED : 0);
+        protocols.push_back(Intern(item.protocol.c_str(), item.protocol.size()));
+        contents.push_back(Intern(item.content.c_str(), item.content.size()));
+        for (const auto& meta : item.metadata) {
+            metaPairs.push_back(Intern(meta.first.data(), meta.first.size()));
+            metaPairs.push_back(Intern(meta.second.data(), meta.second.size()));
+        }
+        metaOffsets.push_back(metaPairs.size() / 2);
+    }
+
+    /**
+     * Returns the number of rows appended so far.
+     */
+    std::size_t RowCount() const { return types.size(); }
+
+    /**
+     * WriteFile Method
+     * ----------------
+     * Writes all rows to `path`, replacing any existing file atomically (temporary file + rename).
+     *
+     * Returns:
+     * - bool: true on success; on failure an error is logged to std::cerr.
+     */
+    bool WriteFile(const std::string& path) const {
+        ResultColumnsHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, kResultColumnsMagic, sizeof(header.magic));
+        header.version = kResultColumnsVersion;
+        header.rowCount = types.size();
+        header.metaPairCount = metaPairs.size() / 2;
+        header.dictCount = dictOffsets.size() - 1;
+
+        // Lay out the sections, each 8-byte aligned.
+        std::uint64_t cursor = sizeof(header);
+        header.sourceOffsets = Place(cursor, Bytes(sourceOffsets));
+        header.sourceBytes = Place(cursor, Bytes(sourceBytes));
+        header.types = Place(cursor, Bytes(types));
+        header.statuses = Place(cursor, Bytes(statuses));
+        header.protocols = Place(cursor, Bytes(protocols));
+        header.contents = Place(cursor, Bytes(contents));
+        header.metaOffsets = Place(cursor, Bytes(metaOffsets));
+        header.metaPairs = Place(cursor, Bytes(metaPairs));
+        header.dictOffsets = Place(cursor, Bytes(dictOffsets));
+        header.dictBytes = Place(cursor, Bytes(dictBytes));
+        header.fileSize = cursor;
+
+        // The temporary file lives in the target's directory so that the rename stays on one file system.
+        std::vector<char> temporary(path.begin(), path.end());
+        const char suffix[] = ".XXXXXX";
+        temporary.insert(temporary.end(), suffix, suffix + sizeof(suffix));
+        int fd = ::mkstemp(temporary.data());
+        if (fd < 0) {
+            std::cerr << "Cannot create temporary result file for: " << path << "\n";
+            return false;
+        }
+        if (!WriteMapped(fd, temporary.data(), header)) {
+            ::unlink(temporary.data());
+            return false;
+        }
+        if (std::rename(temporary.data(), path.c_str()) != 0) {
+            std::cerr << "Cannot replace result file: " << path << "\n";
+            ::unlink(temporary.data());
+            return false;
+        }
+        return true;
+    }
+
+private:
+    // Sizes the open file `fd` (named `path`) to the laid-out size, maps it and copies every column in.
+    // Closes `fd`. mkstemp creates the file owner-only; it gets the usual 0644 result file mode here.
+    bool WriteMapped(int fd, const char* path, const ResultColumnsHeader& header) const {
+        if (::fchmod(fd, 0644) != 0 || ::ftruncate(fd, static_cast<off_t>(header.fileSize)) != 0) {
+            std::cerr << "Cannot size result file: " << path << "\n";
+            ::close(fd);
+            return false;
+        }
+        void* mapped = ::mmap(nullptr, header.fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) {
+            std::cerr << "Cannot map result file: " << path << "\n";
+            return false;
+        }
+
+        char* base = static_cast<char*>(mapped);
+        std::memcpy(base, &header, sizeof(header));
+        Copy(base, header.sourceOffsets, sourceOffsets);
+        Copy(base, header.sourceBytes, sourceBytes);
+        Copy(base, header.types, types);
+        Copy(base, header.statuses, statuses);
+        Copy(base, header.protocols, protocols);
+        Copy(base, header.contents, contents);
+        Copy(base, header.metaOffsets, metaOffsets);
+        Copy(base, header.metaPairs, metaPairs);
+        Copy(base, header.dictOffsets, dictOffsets);
+        Copy(base, header.dictBytes, dictBytes);
+
+        bool synced = ::msync(mapped, header.fileSize, MS_SYNC) == 0;
+        ::munmap(mapped, header.fileSize);
+        if (!synced) std::cerr << "Cannot flush result file: " << path << "\n";
+        return synced;
+    }
+
+    template <typename T>
+    static std::uint64_t Bytes(const std::vector<T>& column) { return column.size() * sizeof(T); }
+
+    // Reserves `size` bytes at the 8-byte aligned cursor and returns their offset.
+    static std::uint64_t Place(std::uint64_t& cursor, std::uint64_t size) {
+        std::uint64_t offset = (cursor + 7) & ~static_cast<std::uint64_t>(7);
+        cursor = offset + size;
+        return offset;
+    }
+
+    template <typename T>
+    static void Copy(char* base, std::uint64_t offset, const std::vector<T>& column) {
+        if (!column.empty()) std::memcpy(base + offset, column.data(), column.size() * sizeof(T));
+    }
+
+    // Returns the dictionary id of a string, adding it on first use.
+    std::uint32_t Intern(const char* data, std::size_t size) {
+        std::string key(data, size);
+        auto found = dictionary.find(key);
+        if (found != dictionary.end()) return found->second;
+        std::uint32_t id = static_cast<std::uint32_t>(dictOffsets.size() - 1);
+        dictionary.emplace(std::move(key), id);
+        dictBytes.insert(dictBytes.end(), data, data + size);
+        dictOffsets.push_back(dictBytes.size());
+        return id;
+    }
+
+    std::vector<std::uint64_t> sourceOffsets;
+    std::vector<char> sourceBytes;
+    std::vector<std::uint8_t> types;
+    std::vector<std::uint8_t> statuses;
+    std::vector<std::uint32_t> protocols;
+    std::vector<std::uint32_t> contents;
+    std::vector<std::uint64_t> metaOffsets;
+    std::vector<std::uint32_t> metaPairs;
+    std::vector<std::uint64_t> dictOffsets;
+    std::vector<char> dictBytes;
+    std::unordered_map<std::string, std::uint32_t> dictionary; // String -> dictionary id.
+};
+
+#endif
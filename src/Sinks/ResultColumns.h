@@ -0,0 +1,64 @@
+#ifndef RESULT_COLUMNS_H
+#define RESULT_COLUMNS_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * ResultColumns Format
+ * --------------------
+ * Binary layout shared by ResultColumnWriter and ResultColumnReader.
+ * A file stores one row per processed ActionResult, split into columns so that analytics can scan
+ * a single field (e.g., all types) without touching the others.
+ *
+ * Layout (native byte order, every section 8-byte aligned):
+ * - ResultColumnsHeader
+ * - sourceOffsets  uint64[rowCount + 1]  Row i's source is sourceBytes[offsets[i], offsets[i+1]).
+ * - sourceBytes    char[]                Concatenated sources (not null-terminated).
+ * - types          uint8[rowCount]       DataType of each row.
+ * - statuses       uint8[rowCount]       Bit flags, see ResultStatus.
+ * - protocols      uint32[rowCount]      Dictionary id of the protocol.
+ * - contents       uint32[rowCount]      Dictionary id of the content description.
+ * - metaOffsets    uint64[rowCount + 1]  Row i's metadata is metaPairs[offsets[i], offsets[i+1]).
+ * - metaPairs      uint32[2 * pairs]     (key id, value id) pairs into the dictionary.
+ * - dictOffsets    uint64[dictCount + 1] Entry j is dictBytes[offsets[j], offsets[j+1]).
+ * - dictBytes      char[]                Concatenated dictionary strings.
+ */
+
+constexpr char kResultColumnsMagic[4] = { 'C', 'P', 'R', 'C' };
+constexpr std::uint32_t kResultColumnsVersion = 1;
+
+/**
+ * ResultStatus Flags
+ * ------------------
+ * Bit flags stored in the statuses column.
+ */
+enum ResultStatus : std::uint8_t {
+    RESULT_STATUS_PROCESSED = 1 << 0, // ActionResult::isProcessed was set.
+};
+
+/**
+ * ResultColumnsHeader Struct
+ * --------------------------
+ * Fixed-size file header: counts plus the byte offset of every column section.
+ */
+struct ResultColumnsHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint64_t rowCount;
+    std::uint64_t metaPairCount;
+    std::uint64_t dictCount;
+    std::uint64_t sourceOffsets;
+    std::uint64_t sourceBytes;
+    std::uint64_t types;
+    std::uint64_t statuses;
+    std::uint64_t protocols;
+    std::uint64_t contents;
+    std::uint64_t metaOffsets;
+    std::uint64_t metaPairs;
+    std::uint64_t dictOffsets;
+    std::uint64_t dictBytes;
+    std::uint64_t fileSize;
+};
+
+#endif
@@ -0,0 +1,184 @@
+#ifndef COROUTINE_EXECUTOR_H
+#define COROUTINE_EXECUTOR_H
+
+#ifdef COMPUTE_PIPELINE_COROUTINES
+
+#include "../Core/ActionResult.h"          // Core structure for processing results.
+#include "../Core/Task.h"                  // Coroutine task types.
+#include "../Factories/LoaderFactory.h"    // Factory for selecting the appropriate Loader.
+#include "../Systems/PipelineManager.h"    // Pass limit shared with the other executors.
+#include "../Utils/CoroutineScheduler.h"   // Worker threads and timers for coroutines.
+#include "../Utils/PipelineConfig.h"       // Compiled stage graph and dispatch table.
+#include "../Utils/SchemeDetector.h"       // Batch scheme classification.
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * CoroutineExecutor Class (C++20)
+ * -------------------------------
+ * Alternative to PipelineExecutor that runs every item as a coroutine on a few scheduler threads.
+ * An item waiting on I/O (ILoader::LoadAsync) is suspended instead of occupying a thread, so thousands
+ * of items can be in flight at once.
+ *
+ * Responsibilities:
+ * - Starts up to `maxInFlight` coroutine lanes; each lane takes the next source, loads it with
+ *   LoadAsync and runs it through the stages with IProcessor::ProcessAsync until it is processed.
+ * - Each lane creates a stage's processor on first use and keeps it for all its items (a lane runs
+ *   one item at a time, so its processors are never used concurrently).
+ * - Uses the same dispatch table, `emits` check, pass limit, batch/item deadlines and cancellation
+ *   checks as PipelineExecutor.
+ * - Returns one result slot per source (nullptr when no suitable Loader was found).
+ *
+ * Notes:
+ * - The memory budget and duplicate coalescing of PipelineExecutor are not applied here: both block
+ *   or park a thread, which would stall the few scheduler threads.
+ */
+class CoroutineExecutor {
+public:
+    /**
+     * Constructor
+     * -----------
+     * Parameters:
+     * - pipeline (CompiledPipeline): A validated pipeline.
+     * - threads (std::size_t): Scheduler worker threads.
+     * - maxInFlight (std::size_t): Maximum number of items being loaded or processed at once.
+     */
+    CoroutineExecutor(CompiledPipeline pipeline, std::size_t threads, std::size_t maxInFlight)
+        : pipeline(std::move(pipeline)), threads(threads), maxInFlight(maxInFlight > 0 ? maxInFlight : 1) {
+    }
+
+    /**
+     * RunEach Method
+     * --------------
+     * Processes all sources and blocks until every item has finished.
+     *
+     * Returns:
+     * - std::vector<std::unique_ptr<ActionResult>>: The result for sources[i] at index i,
+     *   or nullptr when no suitable Loader was found for that source.
+     */
+    std::vector<std::unique_ptr<ActionResult>> RunEach(const std::vector<std::string>& sources,
+                                                       const CancellationToken& cancel = CancellationToken()) {
+        RunState state(sources);
+        state.batch = cancel;
+        if (pipeline.batchTimeoutMs > 0) {
+            state.batch = cancel.WithDeadline(CancellationToken::Clock::now() +
+                                              std::chrono::milliseconds(pipeline.batchTimeoutMs));
+        }
+        std::size_t lanes = sources.size() < maxInFlight ? sources.size() : maxInFlight;
+        state.activeLanes = lanes;
+        {
+            CoroutineScheduler scheduler(threads);
+            for (std::size_t i = 0; i < lanes; ++i) scheduler.Post(Lane(state).Handle());
+
+            std::unique_lock<std::mutex> lock(state.doneMutex);
+            state.doneSignal.wait(lock, [&state] { return state.activeLanes == 0; });
+        }
+        return std::move(state.results);
+    }
+
+private:
+    /**
+     * RunState Struct
+     * ---------------
+     * Sources, results and lane tracking for a single RunEach call.
+     */
+    struct RunState {
+        explicit RunState(const std::vector<std::string>& sources)
+            : sources(sources), schemes(DetectSchemes(sources)), types(DetectFileTypes(sources)),
+              results(sources.size()), next(0), activeLanes(0) {
+        }
+
+        const std::vector<std::string>& sources;
+        std::vector<SourceScheme> schemes;                   // Scheme of each source, classified up front.
+        std::vector<DataType> types;                         // File type of each source, classified up front.
+        std::vector<std::unique_ptr<ActionResult>> results;  // One slot per source.
+        CancellationToken batch;                             // Cancelled with the batch.
+        std::atomic<std::size_t> next;                       // Next source index to start.
+        std::size_t activeLanes;                             // Lanes still running.
+        std::mutex doneMutex;                                // Guards activeLanes.
+        std::condition_variable doneSignal;                  // Signalled when the last lane finishes.
+    };
+
+    /**
+     * A lane keeps one item in flight at a time, taking sources until none are left.
+     */
+    DetachedTask Lane(RunState& state) {
+        std::vector<std::unique_ptr<IProcessor>> processors(pipeline.stages.size());
+        for (;;) {
+            std::size_t index = state.next.fetch_add(1, std::memory_order_relaxed);
+            if (index >= state.sources.size()) break;
+            co_await ProcessSource(state, index, processors);
+        }
+        // Notify under the lock: RunEach may destroy `state` as soon as the lock is released.
+        std::lock_guard<std::mutex> lock(state.doneMutex);
+        if (--state.activeLanes == 0) state.doneSignal.notify_all();
+    }
+
+    /**
+     * Loads one source and runs it through the stages, using (and filling) the lane's processors.
+     */
+    Task<void> ProcessSource(RunState& state, std::size_t index, std::vector<std::unique_ptr<IProcessor>>& processors) {
+        const std::string& source = state.sources[index];
+        std::unique_ptr<ILoader> loader = LoaderFactory::CreateLoader(state.schemes[index], source);
+        if (loader == nullptr) {
+            std::cerr << "No suitable Loader for: " << source << "\n";
+            co_return;
+        }
+        loader->SetSimulatedLatency(std::chrono::milliseconds(pipeline.httpLatencyMs));
+        CancellationToken token = state.batch;
+        if (pipeline.itemTimeoutMs > 0) {
+            token = state.batch.WithDeadline(CancellationToken::Clock::now() +
+                                             std::chrono::milliseconds(pipeline.itemTimeoutMs));
+        }
+        loader->SetCancellation(token);
+        loader->SetSourceType(state.types[index]);
+        // A cancelled batch only drains: remaining sources are not loaded.
+        ActionResult item(DataType::UNKNOWN, source, "none"_sr, "Not Loaded"_sr);
+        if (!state.batch.IsCancelled()) item = co_await loader->LoadAsync(source);
+        item.cancellation = std::move(token);
+
+        int previousStage = -1;
+        for (std::size_t pass = 0; !item.isProcessed; ++pass) {
+            if (item.StopIfCancelled()) break;
+            if (pass == PipelineManager::kMaxPasses) {
+                item.metadata["Pipeline Stopped"] = "Pass limit reached";
+                item.isProcessed = true;
+                break;
+            }
+            if (previousStage >= 0 && !pipeline.stages[static_cast<std::size_t>(previousStage)].Emits(item.type)) {
+                item.metadata["Pipeline Stopped"] = "Stage '" + pipeline.stages[static_cast<std::size_t>(previousStage)].config.name +
+                                                    "' emitted undeclared type " + DataTypeName(item.type);
+                item.isProcessed = true;
+                break;
+            }
+            int stage = pipeline.StageFor(item.type);
+            if (stage < 0) {
+                std::cout << "No processor found for type: " << static_cast<int>(item.type) << "\n";
+                item.isProcessed = true;
+                break;
+            }
+            std::unique_ptr<IProcessor>& processor = processors[static_cast<std::size_t>(stage)];
+            if (!processor) processor = pipeline.stages[static_cast<std::size_t>(stage)].createProcessor();
+            co_await processor->ProcessAsync(item);
+            previousStage = stage;
+        }
+
+        item.ReleasePayload();
+        state.results[index].reset(new ActionResult(std::move(item)));
+    }
+
+    CompiledPipeline pipeline; // Stage graph, dispatch table and processor factories.
+    std::size_t threads;       // Scheduler worker threads.
+    std::size_t maxInFlight;   // Maximum concurrent lanes.
+};
+
+#endif // COMPUTE_PIPELINE_COROUTINES
+
+#endif
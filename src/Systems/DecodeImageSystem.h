@@ -33,7 +33,7 @@ public:
         std::cout << "Decoding Image...\n";
 
         // Set the content to indicate the image has been decoded.
-        item.content = "Decoded Image";
+        item.content = "Decoded Image"_sr;
 
         // Add metadata to track the action taken.
         item.metadata["Action"] = "Image Decoded";
@@ -5,9 +5,18 @@
 #include "../Core/ActionResult.h"     // Core structure for processing results.
 #include "../Utils/TypeDetector.h"    // Utility for detecting file types.
 #include "../Utils/RandomSelector.h"  // Utility for selecting random extensions.
+#include "../Utils/ParseUtils.h"      // Bounded count parsing for the archive depth.
+#include <cstddef>
 #include <iostream>
+#include <string>
 #include <vector>
 
+/**
+ * Largest "Archive Depth" read back from metadata. The pipeline's pass limit keeps real nesting far
+ * below it, so a larger value is malformed.
+ */
+constexpr std::size_t kMaxArchiveDepth = 1024;
+
 /**
  * DecompressSystem Class
  * ----------------------
@@ -16,9 +25,10 @@
  *
  * Responsibilities:
  * - Simulates the decompression of a file.
- * - Generates a new file extension randomly for the decompressed content.
+ * - Generates a new file extension randomly for the decompressed content (deterministic for a
+ *   given seed, source and nesting depth).
  * - Updates the ActionResult with the new source and type.
- * - Adds metadata to track the decompression action.
+ * - Adds metadata to track the decompression action and the archive nesting depth.
  */
 class DecompressSystem : public IProcessor {
 public:
@@ -38,21 +48,33 @@ public:
         // (IMPORTANT) Randomly generates a new file extension for the decompressed content.
         // This is not necessary for the processing itself, but is used to simulate the output
         // of a decompression action, making it look like a new file was extracted from the compressed one.
-        std::string newExtension = GetRandomExtension();
+        // The choice is keyed by the source and how many archive layers were already opened, so a
+        // nested archive with an unchanged name still gets a fresh choice at every level.
+        std::size_t depth = 0;
+        auto depthEntry = item.metadata.find("Archive Depth");
+        if (depthEntry != item.metadata.end()) {
+            // A malformed or out-of-range depth (e.g., set by a custom processor) counts as the outer
+            // layer instead of throwing.
+            if (!ParseCount(depthEntry->second, depth, kMaxArchiveDepth, true)) depth = 0;
+        }
+        const std::string& newExtension = GetRandomExtension(item.source, depth);
 
         // (IMPORTANT) Update the source and content to reflect the decompressed state.
         // This line is purely for simulation purposes. It is not required for the actual pipeline logic,
         // but is used to demonstrate how the source might change after decompression (e.g., .zip -> .jpg).
-        std::string newSource = item.source.substr(0, item.source.find_last_of('.')) + newExtension;
-        item.source = newSource;
-        item.content = "Decompressed Content";
+        // The extension is replaced in place to avoid building a temporary source string.
+        std::string::size_type dot = item.source.find_last_of('.');
+        if (dot == std::string::npos) dot = item.source.size();
+        item.source.replace(dot, std::string::npos, newExtension);
+        item.content = "Decompressed Content"_sr;
 
         // Detect and set the next type for the ActionResult.
-        item.type = DetectFileType(newSource);
+        item.type = DetectFileType(item.source);
 
         // Add metadata to track the action and the new extension.
         item.metadata["File Uncompressed"] = newExtension;
         item.metadata["Action"] = "File Decompressed";
+        item.metadata["Archive Depth"] = std::to_string(depth + 1);
     }
 };
 
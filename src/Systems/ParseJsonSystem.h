@@ -32,7 +32,7 @@ public:
         std::cout << "Converting JSON to C++ Object...\n";
 
         // Set the content to indicate JSON has been parsed.
-        item.content = "JSON Parsed";
+        item.content = "JSON Parsed"_sr;
 
         // Add metadata to track the action taken.
         item.metadata["Action"] = "JSON Parsed";
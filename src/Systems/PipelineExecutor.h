@@ -0,0 +1,421 @@
+#ifndef PIPELINE_EXECUTOR_H
+#define PIPELINE_EXECUTOR_H
+
+#include "../Core/ActionResult.h"       // Core structure for processing results.
+#include "../Core/IProcessor.h"         // Interface for processing systems.
+#include "../Factories/LoaderFactory.h" // Factory for selecting the appropriate Loader.
+#include "../Systems/PipelineManager.h" // Pass limit shared with the sequential pipeline.
+#include "../Utils/BoundedQueue.h"      // Queues connecting loaders and stages.
+#include "../Utils/CpuTopology.h"       // NUMA nodes and thread pinning.
+#include "../Utils/InFlightTable.h"     // Coalescing of duplicate sources.
+#include "../Utils/PipelineConfig.h"    // Compiled stage graph and dispatch table.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * PipelineExecutor Class
+ * ----------------------
+ * Runs a batch of sources through a CompiledPipeline using one bounded queue and a pool of
+ * worker threads per stage.
+ *
+ * Responsibilities:
+ * - Classifies all source schemes and file types in one batch pass each, then loads sources on
+ *   `loaderThreads` loader workers (LoaderFactory + ILoader::Load).
+ * - Routes each item to the stage that accepts its DataType using the flat dispatch table. An item
+ *   whose new type is not in the `emits` list of the stage that produced it is stopped instead, so
+ *   processors cannot add edges (and with them queue cycles that could deadlock) to the validated graph.
+ * - Runs `threads` replicas per stage; each replica owns its own processor instance.
+ * - Takes up to `batchSize` items per wake-up and blocks producers when a stage queue is full.
+ * - Coalesces duplicate sources: while a source is being loaded or processed, further requests for it
+ *   are attached to that leader instead of loading again. Once the leader finishes, each follower gets
+ *   a copy of its finished result (type, content and metadata; finished items never hold a payload)
+ *   and the source leaves the in-flight table, so a request arriving later loads it again.
+ * - Enforces the payload memory budget: loaders block in ILoader::ReserveData while the budget is
+ *   exhausted, and each item's payload and reservation are released as soon as it is finished.
+ * - Returns the finished items in input order (sources without a suitable Loader are skipped).
+ * - With `pinThreads`, spreads loader and stage workers over the NUMA nodes and pins each one to a
+ *   CPU. An item stays tagged with the node whose loader filled its payload (first touch, or the
+ *   libnuma preferred node). Each stage queue keeps one partition per node the stage has a replica
+ *   on; items of a node without a replica go to the partition of node `node % replicaNodes`. Workers
+ *   take items of their own partition first, steal from the others when it is empty, and never let
+ *   an item be overtaken by more than kMaxPreferredSkips younger ones, so no node is starved.
+ * - Stops items cooperatively: each item carries a token that is cancelled with the batch (the
+ *   caller's token or `batchTimeoutMs`) or once its own `itemTimeoutMs` deadline passes. Stopped
+ *   items are checked before loading and before every stage pass, marked in metadata and have
+ *   their payload released at once, so a cancelled batch drains without further work. Loaders get
+ *   the token before Load, so waits for budget or simulated latency end early too.
+ *
+ * Notes:
+ * - A stage that emits its own accepted type (e.g., a zip inside a zip) re-runs the item inline
+ *   instead of re-queueing it, so a full queue can never block its own consumer.
+ */
+class PipelineExecutor {
+public:
+    /**
+     * RunStats Struct
+     * ---------------
+     * Counters for the most recent Run call.
+     * - loads: Requests that went to a Loader (at most one per source at a time, including rejected ones).
+     * - coalescedLoads: Requests served from an in-flight request's load instead of loading again.
+     * - peakBudgetBytes: Highest payload memory reserved at once during the run.
+     * - budgetWaits: Payload reservations that had to wait for budget.
+     * - numaNodes: Nodes the workers were spread over (1 when pinning is off).
+     * - crossNodeItems: Stage passes that ran on a different node than the item's loader.
+     * - stoppedItems: Items stopped early by cancellation, a deadline or the pass limit.
+     */
+    struct RunStats {
+        std::size_t loads = 0;
+        std::size_t coalescedLoads = 0;
+        std::size_t peakBudgetBytes = 0;
+        std::size_t budgetWaits = 0;
+        std::size_t numaNodes = 1;
+        std::size_t crossNodeItems = 0;
+        std::size_t stoppedItems = 0;
+    };
+
+    /**
+     * Most younger items a stage worker takes from its own node before an older item queued for
+     * another node is taken instead.
+     */
+    static constexpr std::size_t kMaxPreferredSkips = 64;
+
+    /**
+     * Constructor
+     * -----------
+     * Parameters:
+     * - pipeline (CompiledPipeline): A validated pipeline, usually from PipelineManagerFactory::CompilePipeline.
+     */
+    explicit PipelineExecutor(CompiledPipeline pipeline)
+        : pipeline(std::move(pipeline)), budget(this->pipeline.memoryLimitBytes) {
+    }
+
+    /**
+     * Run Method
+     * ----------
+     * Processes all sources and blocks until every item has finished.
+     *
+     * Parameters:
+     * - sources (const std::vector<std::string>&): The input sources (file paths, URLs, bundles).
+     * - cancel (const CancellationToken&): Cancels the whole batch when cancelled (from any thread).
+     *
+     * Returns:
+     * - std::vector<ActionResult>: The processed items, in input order.
+     */
+    std::vector<ActionResult> Run(const std::vector<std::string>& sources,
+                                  const CancellationToken& cancel = CancellationToken()) {
+        std::vector<std::unique_ptr<ActionResult>> slots = RunEach(sources, cancel);
+        std::vector<ActionResult> results;
+        results.reserve(slots.size());
+        for (auto& result : slots) {
+            if (result) results.push_back(std::move(*result));
+        }
+        return results;
+    }
+
+    /**
+     * RunEach Method
+     * --------------
+     * Same as Run, but returns one slot per source so results can be matched to their inputs.
+     *
+     * Returns:
+     * - std::vector<std::unique_ptr<ActionResult>>: The result for sources[i] at index i,
+     *   or nullptr when no suitable Loader was found for that source.
+     *   Sources not loaded because the batch was cancelled get a stopped result.
+     */
+    std::vector<std::unique_ptr<ActionResult>> RunEach(const std::vector<std::string>& sources,
+                                                       const CancellationToken& cancel = CancellationToken()) {
+        // Replicas of each stage (and the loaders) go round-robin over the nodes; within a node,
+        // consecutive workers get consecutive CPUs.
+        CpuTopology topology = pipeline.pinThreads ? CpuTopology::Detect() : CpuTopology();
+        std::size_t nodeCount = pipeline.pinThreads ? topology.NodeCount() : 1;
+        std::vector<std::size_t> nodeSlots(nodeCount, 0);
+
+        RunState state(sources, pipeline, nodeCount);
+        state.batch = cancel;
+        if (pipeline.batchTimeoutMs > 0) {
+            state.batch = cancel.WithDeadline(CancellationToken::Clock::now() +
+                                              std::chrono::milliseconds(pipeline.batchTimeoutMs));
+        }
+        std::size_t waitsBefore = budget.WaitCount();
+        budget.ResetPeak();
+
+        auto place = [&](std::size_t replica) {
+            Placement placement{ replica % nodeCount, -1 };
+            if (pipeline.pinThreads) placement.cpu = topology.CpuFor(placement.node, nodeSlots[placement.node]++);
+            return placement;
+        };
+
+        std::vector<std::thread> workers;
+        for (std::size_t s = 0; s < pipeline.stages.size(); ++s) {
+            for (std::size_t t = 0; t < pipeline.stages[s].config.threads; ++t) {
+                Placement placement = place(t);
+                workers.emplace_back([this, &state, &topology, s, placement] {
+                    Pin(state, topology, placement);
+                    StageWorker(state, s, placement.node);
+                });
+            }
+        }
+        for (std::size_t t = 0; t < pipeline.loaderThreads; ++t) {
+            Placement placement = place(t);
+            workers.emplace_back([this, &state, &topology, placement] {
+                Pin(state, topology, placement);
+                LoaderWorker(state, placement.node);
+            });
+        }
+
+        // Feed the loaders, then wait until every source has been completed or skipped.
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            state.loaderQueue.Push(i);
+        }
+        state.loaderQueue.Close();
+        {
+            std::unique_lock<std::mutex> lock(state.doneMutex);
+            state.doneSignal.wait(lock, [&state] { return state.pending == 0; });
+        }
+        for (auto& queue : state.stageQueues) queue->Close();
+        for (auto& worker : workers) worker.join();
+        if (state.pinFailures > 0) {
+            std::cerr << "Thread pinning unavailable for " << state.pinFailures << " workers; they ran unpinned\n";
+        }
+
+        stats.numaNodes = nodeCount;
+        stats.crossNodeItems = state.crossNodeItems;
+        stats.stoppedItems = state.stoppedItems;
+        stats.loads = state.inFlight.LeaderCount();
+        stats.coalescedLoads = state.inFlight.CoalescedCount();
+        stats.peakBudgetBytes = budget.PeakBytes();
+        stats.budgetWaits = budget.WaitCount() - waitsBefore;
+
+        return std::move(state.results);
+    }
+
+    /**
+     * Returns the counters of the most recent Run call.
+     */
+    const RunStats& LastRunStats() const { return stats; }
+
+    /**
+     * Returns the payload memory budget (current, peak and limit gauges).
+     */
+    const MemoryBudget& Budget() const { return budget; }
+
+private:
+    /**
+     * WorkItem Struct
+     * ---------------
+     * An item in flight, tagged with its input position, the number of stage passes so far, the
+     * node of the loader that filled its payload and the stage that last processed it (-1 before
+     * the first stage).
+     */
+    struct WorkItem {
+        std::size_t index;
+        std::size_t passes;
+        std::size_t node;
+        int stage;
+        ActionResult item;
+    };
+
+    /**
+     * Placement Struct
+     * ----------------
+     * Node and CPU assigned to a worker thread (cpu is -1 when pinning is off).
+     */
+    struct Placement {
+        std::size_t node;
+        int cpu;
+    };
+
+    /**
+     * RunState Struct
+     * ---------------
+     * Queues, results and completion tracking for a single Run call. Replica t of a stage runs on
+     * node t % nodeCount, so a stage has replicas on nodes 0 .. min(threads, nodeCount) - 1 and its
+     * queue gets one partition per such node.
+     */
+    struct RunState {
+        RunState(const std::vector<std::string>& sources, const CompiledPipeline& pipeline, std::size_t nodeCount)
+            : sources(sources), schemes(DetectSchemes(sources)), types(DetectFileTypes(sources)),
+              loaderQueue(pipeline.loaderQueueDepth),
+              results(sources.size()), pending(sources.size()), pinFailures(0), crossNodeItems(0), stoppedItems(0) {
+            for (const CompiledStage& stage : pipeline.stages) {
+                std::size_t replicaNodes = std::max<std::size_t>(1, std::min(stage.config.threads, nodeCount));
+                stageNodes.push_back(replicaNodes);
+                stageQueues.emplace_back(new BoundedQueue<WorkItem>(stage.config.queueDepth, replicaNodes));
+            }
+        }
+
+        const std::vector<std::string>& sources;
+        std::vector<SourceScheme> schemes;    // Scheme of each source, classified up front.
+        std::vector<DataType> types;          // File type of each source, classified up front.
+        BoundedQueue<std::size_t> loaderQueue;
+        std::vector<std::unique_ptr<BoundedQueue<WorkItem>>> stageQueues;
+        std::vector<std::size_t> stageNodes;  // Nodes with a replica of each stage (= queue partitions).
+        InFlightTable inFlight;               // Sources being loaded or processed, keyed by source.
+        CancellationToken batch;              // Cancelled with the batch; parent of every item token.
+        std::vector<std::unique_ptr<ActionResult>> results;
+        std::size_t pending;                  // Sources not yet completed or skipped.
+        std::mutex doneMutex;                 // Guards pending.
+        std::condition_variable doneSignal;   // Signalled when pending reaches zero.
+        std::atomic<std::size_t> pinFailures;    // Workers that could not be pinned.
+        std::atomic<std::size_t> crossNodeItems; // Stage passes taken from another node's loader.
+        std::atomic<std::size_t> stoppedItems;   // Items finished with a "Pipeline Stopped" entry.
+    };
+
+    /**
+     * Pins the calling worker thread to its CPU (no-op when pinning is off).
+     */
+    void Pin(RunState& state, const CpuTopology& topology, const Placement& placement) {
+        if (placement.cpu < 0) return;
+        if (!topology.PinCurrentThread(placement.node, placement.cpu)) ++state.pinFailures;
+    }
+
+    /**
+     * Loader worker: loads sources and routes the resulting items to their first stage.
+     */
+    void LoaderWorker(RunState& state, std::size_t node) {
+        std::vector<std::size_t> batch;
+        while (state.loaderQueue.PopBatch(batch, 1)) {
+            for (std::size_t index : batch) {
+                const std::string& source = state.sources[index];
+
+                // Duplicates of an in-flight source share the leader's work instead of loading again.
+                if (state.inFlight.Acquire(source, index) == InFlightTable::Claim::WAITING) continue;
+
+                // A cancelled batch only drains: remaining sources are not loaded.
+                if (state.batch.IsCancelled()) {
+                    ActionResult skipped(DataType::UNKNOWN, source, "none"_sr, "Not Loaded"_sr);
+                    skipped.cancellation = state.batch;
+                    skipped.StopIfCancelled();
+                    Route(state, WorkItem{ index, 0, node, -1, std::move(skipped) });
+                    continue;
+                }
+
+                std::unique_ptr<ILoader> loader = LoaderFactory::CreateLoader(state.schemes[index], source);
+                if (loader == nullptr) {
+                    std::cerr << "No suitable Loader for: " << source << "\n";
+                    Publish(state, index);
+                    continue;
+                }
+                CancellationToken token = state.batch;
+                if (pipeline.itemTimeoutMs > 0) {
+                    token = state.batch.WithDeadline(CancellationToken::Clock::now() +
+                                                     std::chrono::milliseconds(pipeline.itemTimeoutMs));
+                }
+                // The loader gets the token up front, so its budget and latency waits end on cancellation.
+                loader->SetMemoryBudget(&budget);
+                loader->SetSimulatedLatency(std::chrono::milliseconds(pipeline.httpLatencyMs));
+                loader->SetCancellation(token);
+                loader->SetSourceType(state.types[index]);
+                ActionResult item = loader->Load(source);
+                item.cancellation = std::move(token); // Also for loaders that reserve no budget.
+                Route(state, WorkItem{ index, 0, node, -1, std::move(item) });
+            }
+            batch.clear();
+        }
+    }
+
+    /**
+     * Stage worker: runs one replica of a stage over batches taken from the stage queue,
+     * preferring items of its own node's partition.
+     */
+    void StageWorker(RunState& state, std::size_t stageIndex, std::size_t node) {
+        std::unique_ptr<IProcessor> processor = pipeline.stages[stageIndex].createProcessor();
+        std::size_t batchSize = pipeline.stages[stageIndex].config.batchSize;
+        std::vector<WorkItem> batch;
+        batch.reserve(batchSize);
+
+        BoundedQueue<WorkItem>& queue = *state.stageQueues[stageIndex];
+        while (queue.PopBatchPreferring(batch, batchSize, node, kMaxPreferredSkips)) {
+            for (WorkItem& work : batch) {
+                if (work.node != node) ++state.crossNodeItems;
+                work.stage = static_cast<int>(stageIndex);
+                // Re-run inline while the item stays in this stage (declared self-loop).
+                do {
+                    if (work.item.StopIfCancelled()) break;
+                    processor->Process(work.item);
+                    ++work.passes;
+                } while (!work.item.isProcessed && work.passes < PipelineManager::kMaxPasses &&
+                         pipeline.stages[stageIndex].Emits(work.item.type) &&
+                         pipeline.StageFor(work.item.type) == static_cast<int>(stageIndex));
+                Route(state, std::move(work));
+            }
+            batch.clear();
+        }
+    }
+
+    /**
+     * Sends an item to the stage for its type, or completes it if it is finished.
+     */
+    void Route(RunState& state, WorkItem work) {
+        if (!work.item.isProcessed && work.passes >= PipelineManager::kMaxPasses) {
+            work.item.metadata["Pipeline Stopped"] = "Pass limit reached";
+            work.item.isProcessed = true;
+        }
+        if (!work.item.isProcessed && work.stage >= 0) {
+            const CompiledStage& from = pipeline.stages[static_cast<std::size_t>(work.stage)];
+            if (!from.Emits(work.item.type)) {
+                work.item.metadata["Pipeline Stopped"] = "Stage '" + from.config.name + "' emitted undeclared type " +
+                                                         DataTypeName(work.item.type);
+                work.item.isProcessed = true;
+            }
+        }
+        if (!work.item.isProcessed && !work.item.StopIfCancelled()) {
+            int stage = pipeline.StageFor(work.item.type);
+            if (stage >= 0) {
+                std::size_t target = static_cast<std::size_t>(stage);
+                std::size_t partition = work.node % state.stageNodes[target];
+                state.stageQueues[target]->Push(std::move(work), partition);
+                return;
+            }
+            std::cout << "No processor found for type: " << static_cast<int>(work.item.type) << "\n";
+            work.item.isProcessed = true;
+        }
+        work.item.ReleasePayload();
+        if (work.item.metadata.count("Pipeline Stopped") > 0) ++state.stoppedItems;
+        state.results[work.index].reset(new ActionResult(std::move(work.item)));
+        Publish(state, work.index);
+    }
+
+    /**
+     * Completes a leader request (whose result, if any, is stored), serves its waiters and drops the
+     * source from the in-flight table.
+     */
+    void Publish(RunState& state, std::size_t index) {
+        std::vector<std::size_t> waiters = state.inFlight.Complete(state.sources[index]);
+        for (std::size_t waiter : waiters) ShareResult(state, index, waiter);
+        Finish(state);
+    }
+
+    /**
+     * Gives request `index` a copy of the leader's finished result (nothing if the leader could not be
+     * loaded). The payload was already released by Route, so the copy carries metadata only.
+     */
+    void ShareResult(RunState& state, std::size_t leaderIndex, std::size_t index) {
+        const std::unique_ptr<ActionResult>& leaderResult = state.results[leaderIndex];
+        if (leaderResult) state.results[index].reset(new ActionResult(leaderResult->Clone()));
+        Finish(state);
+    }
+
+    /**
+     * Marks one source as done and wakes Run when all sources are done.
+     */
+    void Finish(RunState& state) {
+        std::lock_guard<std::mutex> lock(state.doneMutex);
+        if (--state.pending == 0) state.doneSignal.notify_all();
+    }
+
+    CompiledPipeline pipeline; // Stage graph, dispatch table and processor factories.
+    MemoryBudget budget;       // Payload byte budget shared by all loaders.
+    RunStats stats;            // Counters of the most recent Run.
+};
+
+#endif
@@ -6,9 +6,9 @@
 #include "../Systems/DecodeImageSystem.h"    // System for decoding image files.
 #include "../Systems/ParseJsonSystem.h"      // System for parsing JSON files.
 #include "../Systems/UnknownFileSystem.h"    // System for handling unknown file types.
+#include <array>
 #include <memory>
 #include <iostream>
-#include <unordered_map>
 #include <vector>
 
 /**
@@ -37,7 +37,7 @@ public:
      * - processor (std::unique_ptr<IProcessor>): The processor instance to register.
      */
     void RegisterProcessor(DataType type, std::unique_ptr<IProcessor> processor) {
-        processors[type].emplace_back(std::move(processor));
+        processors[static_cast<std::size_t>(type)].emplace_back(std::move(processor));
     }
 
     /**
@@ -47,30 +47,52 @@ public:
      * - Identifies the appropriate processors based on the ActionResult type.
      * - Iterates through all registered processors for that type and executes them.
      * - Stops execution if the item is marked as processed.
+     * - If a processor changed the item type (e.g., decompression), continues with the processors of the new type.
      * - Logs a message if no processor is available for the given type.
+     * - Stops after kMaxPasses passes so that repeatedly nested archives cannot loop forever.
+     * - Stops before each pass once item.cancellation is cancelled or past its deadline
+     *   (see ActionResult::StopIfCancelled); the payload is released right away.
+     * - Releases the item's payload and memory budget reservation once it is fully processed.
      *
      * Parameters:
      * - item (ActionResult&): The ActionResult to be processed.
      */
     void Process(ActionResult& item) {
-        if (processors.find(item.type) != processors.end()) {
-            for (auto& processor : processors[item.type]) {
+        for (std::size_t pass = 0; !item.isProcessed; ++pass) {
+            if (item.StopIfCancelled()) break;
+            if (pass == kMaxPasses) {
+                item.metadata["Pipeline Stopped"] = "Pass limit reached";
+                item.isProcessed = true;
+                break;
+            }
+
+            std::vector<std::unique_ptr<IProcessor>>& stage = processors[static_cast<std::size_t>(item.type)];
+            if (stage.empty()) {
+                std::cout << "No processor found for type: " << static_cast<int>(item.type) << "\n";
+                item.isProcessed = true;
+                break;
+            }
+
+            DataType typeBefore = item.type;
+            for (auto& processor : stage) {
                 processor->Process(item);
-                if (item.isProcessed) break;
+                if (item.isProcessed || item.type != typeBefore || item.StopIfCancelled()) break;
             }
         }
-        else {
-            std::cout << "No processor found for type: " << static_cast<int>(item.type) << "\n";
-            item.isProcessed = true;
-        }
+        item.ReleasePayload();
     }
 
+    /**
+     * Maximum number of dispatch passes per item (one pass per processed type).
+     */
+    static constexpr std::size_t kMaxPasses = 64;
+
 private:
     /**
      * Stores the registered processing systems.
-     * Each DataType maps to a vector of processors, allowing multiple processors per type.
+     * Flat dispatch table indexed by DataType; each entry holds the processors for that type, in order.
      */
-    std::unordered_map<DataType, std::vector<std::unique_ptr<IProcessor>>> processors;
+    std::array<std::vector<std::unique_ptr<IProcessor>>, kDataTypeCount> processors;
 };
 
 #endif
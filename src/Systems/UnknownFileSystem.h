@@ -31,7 +31,7 @@ public:
         std::cout << "Unknown File Type Detected: " << item.source << "\n";
 
         // Set the content to indicate that the file type is not supported.
-        item.content = "Unsupported File Type";
+        item.content = "Unsupported File Type"_sr;
 
         // Add metadata to track the action (or lack of action).
         item.metadata["Action"] = "No action";
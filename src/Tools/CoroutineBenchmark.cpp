@@ -0,0 +1,130 @@
+#include "Factories/PipelineManagerFactory.h"  // Pipeline compilation and the thread-pool executor.
+#include "Systems/CoroutineExecutor.h"         // Coroutine-based executor (C++20 build).
+#include "Utils/ParseUtils.h"                  // Bounded count parsing for the options.
+#include "Utils/PipelineConfig.h"              // Default stage graph.
+#include <chrono>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+
+/**
+ * CoroutineBenchmark Tool
+ * -----------------------
+ * Compares the thread-pool PipelineExecutor with the CoroutineExecutor on I/O-bound input:
+ * every item is an HTTP source whose stubbed round trip takes --latency-ms.
+ *
+ * Usage:
+ *   CoroutineBenchmark --mode threads|coroutines [--config FILE] [--items N] [--in-flight N]
+ *                      [--latency-ms N] [--threads N]
+ *
+ * - threads mode:    the thread pools exactly as configured (--config, or the built-in default
+ *                    pipeline); each loader thread blocks for the round trip.
+ * - coroutines mode: --in-flight coroutine lanes run on --threads scheduler threads.
+ *
+ * Both modes run the same stage graph; only the way loads wait for I/O differs. Counts must be
+ * positive (--latency-ms may be 0) and at most kMaxBenchmarkItems items or lanes, kMaxConfigThreads
+ * threads and kMaxConfigMilliseconds of latency.
+ *
+ * Run each mode in its own process: the reported peak RSS (getrusage) covers the whole process.
+ * Pipeline logging is discarded so that console output does not dominate the measurement.
+ */
+
+// Upper bound for --items and --in-flight: every item keeps its source and result in memory.
+constexpr std::size_t kMaxBenchmarkItems = std::size_t(1) << 24;
+
+// Stream buffer that drops everything; it keeps no state, so concurrent writers are safe.
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return traits_type::not_eof(c); }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+// Reads the count given for `name` into `out` (left unchanged when the option is absent).
+// Returns false and logs the accepted range if the value is not a count in range.
+static bool ArgCount(int argc, char* argv[], const std::string& name, std::size_t& out, std::size_t maxValue,
+                     bool allowZero = false) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (name != argv[i]) continue;
+        if (ParseCount(argv[i + 1], out, maxValue, allowZero)) return true;
+        std::cerr << name << " must be " << CountRange(maxValue, allowZero) << "\n";
+        return false;
+    }
+    return true;
+}
+
+static std::string ArgString(int argc, char* argv[], const std::string& name, const std::string& fallback) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (name == argv[i]) return argv[i + 1];
+    }
+    return fallback;
+}
+
+int main(int argc, char* argv[]) {
+    std::string mode = ArgString(argc, argv, "--mode", "coroutines");
+    std::string configPath = ArgString(argc, argv, "--config", "");
+    std::size_t items = 10000;
+    std::size_t inFlight = 10000;
+    std::size_t latencyMs = 100;
+    std::size_t threads = 4;
+    bool valid = ArgCount(argc, argv, "--items", items, kMaxBenchmarkItems) &&
+                 ArgCount(argc, argv, "--in-flight", inFlight, kMaxBenchmarkItems) &&
+                 ArgCount(argc, argv, "--latency-ms", latencyMs, kMaxConfigMilliseconds, true) &&
+                 ArgCount(argc, argv, "--threads", threads, kMaxConfigThreads);
+    if (!valid || (mode != "threads" && mode != "coroutines")) {
+        std::cerr << "Usage: " << argv[0] << " --mode threads|coroutines [--config FILE] [--items N] [--in-flight N]"
+                  << " [--latency-ms N] [--threads N]\n";
+        return 1;
+    }
+
+    PipelineConfig config = PipelineConfig::Default();
+    std::vector<std::string> errors;
+    if (!configPath.empty() && !LoadPipelineConfig(configPath, config, errors)) {
+        for (const auto& error : errors) std::cerr << "Config error: " << error << "\n";
+        return 1;
+    }
+    config.httpLatencyMs = latencyMs;
+    CompiledPipeline pipeline;
+    if (!PipelineManagerFactory::CompilePipeline(config, pipeline, errors)) {
+        for (const auto& error : errors) std::cerr << "Config error: " << error << "\n";
+        return 1;
+    }
+
+    std::vector<std::string> sources;
+    sources.reserve(items);
+    for (std::size_t i = 0; i < items; ++i) {
+        sources.push_back("http://bench/item" + std::to_string(i) + (i % 2 ? ".json" : ".jpg"));
+    }
+
+    // Discard the per-item log lines written by loaders and systems.
+    NullBuffer discard;
+    std::streambuf* console = std::cout.rdbuf(&discard);
+
+    // Threads of the configured pools (loaders plus every stage replica).
+    std::size_t poolThreads = config.loaderThreads;
+    for (const StageConfig& stage : config.stages) poolThreads += stage.threads;
+
+    auto start = std::chrono::steady_clock::now();
+    std::size_t completed = 0;
+    if (mode == "threads") {
+        PipelineExecutor executor(pipeline);
+        for (const auto& result : executor.RunEach(sources)) completed += result ? 1 : 0;
+    }
+    else {
+        CoroutineExecutor executor(pipeline, threads, inFlight);
+        for (const auto& result : executor.RunEach(sources)) completed += result ? 1 : 0;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout.rdbuf(console);
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    std::cout << "mode=" << mode << " items=" << completed
+              << " in_flight=" << (mode == "threads" ? config.loaderThreads : inFlight)
+              << " latency_ms=" << latencyMs << " threads=" << (mode == "threads" ? poolThreads : threads) << "\n";
+    std::cout << "elapsed_s=" << seconds << " items_per_s=" << (seconds > 0 ? completed / seconds : 0)
+              << " peak_rss_kb=" << usage.ru_maxrss << "\n";
+    return completed == items ? 0 : 1;
+}
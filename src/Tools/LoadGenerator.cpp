@@ -0,0 +1,372 @@
+#include "Utils/ParseUtils.h"       // Count and byte size parsing shared with the config file.
+#include "Utils/RandomSelector.h"   // Seeded, platform-independent generator.
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+
+/**
+ * LoadGenerator Tool
+ * ------------------
+ * Writes a synthetic input corpus of real .jpg, .json and .zip files, plus an inputs file that
+ * ComputePipeline replays with --inputs (it carries the seed, so runs are comparable across builds).
+ *
+ * Usage:
+ *   LoadGenerator --out DIR [--count N] [--seed N] [--mix jpg=40,json=40,zip=20]
+ *                 [--size fixed:SIZE | uniform:MIN:MAX | lognormal:MEDIAN:SIGMA]
+ *                 [--zip-entries N] [--max-depth N] [--inputs FILE]
+ *
+ * - Sizes accept K/M/G suffixes and must fit in 32 bits; drawn sizes are capped there too. The size
+ *   drawn for an archive is split among its entries.
+ * - --zip-entries takes 1 to 65535 entries per archive. An archive whose headers push it past 4 GiB
+ *   (many entries, deep nesting) is reported as an error instead of being written with wrapped offsets.
+ * - Archive entries follow the same type mix; a .zip entry nests another archive until --max-depth.
+ * - --inputs defaults to DIR/inputs.txt.
+ *
+ * Files:
+ * - jpg:  a valid 8x8 grayscale baseline JPEG, padded to size with comment segments.
+ * - json: an array of records, padded to size.
+ * - zip:  a stored (uncompressed) ZIP archive with CRC-32 checksums; no ZIP64, so sizes stay below 4 GiB.
+ */
+
+namespace {
+
+// Without ZIP64, entry counts are 16-bit and sizes and offsets 32-bit fields.
+constexpr std::size_t kMaxZipEntries = 0xFFFF;
+constexpr std::size_t kMaxFileBytes = 0xFFFFFFFFu;
+
+enum class FileKind { JPG, JSON, ZIP };
+
+const char* Extension(FileKind kind) {
+    return kind == FileKind::JPG ? ".jpg" : kind == FileKind::JSON ? ".json" : ".zip";
+}
+
+struct SizeDistribution {
+    enum class Shape { FIXED, UNIFORM, LOGNORMAL } shape = Shape::FIXED;
+    double first = 16 * 1024;  // Fixed size, uniform minimum or lognormal median.
+    double second = 0;         // Uniform maximum or lognormal sigma.
+
+    std::size_t Draw(RandomGenerator& random) const {
+        double size = first;
+        if (shape == Shape::UNIFORM) {
+            size = first + random.NextDouble() * (second - first);
+        }
+        else if (shape == Shape::LOGNORMAL) {
+            // Box-Muller transform: a standard normal sample from two uniform ones.
+            double u1 = 1.0 - random.NextDouble();
+            double u2 = random.NextDouble();
+            double normal = std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+            size = first * std::exp(second * normal);
+        }
+        if (size >= static_cast<double>(kMaxFileBytes)) return kMaxFileBytes;
+        return size < 1 ? 1 : static_cast<std::size_t>(size);
+    }
+};
+
+struct Options {
+    std::string outDir;
+    std::string inputsPath;
+    std::size_t count = 100;
+    std::uint64_t seed = kDefaultRandomSeed;
+    std::vector<unsigned> weights = { 40, 40, 20 }; // jpg, json, zip.
+    SizeDistribution sizes;
+    std::size_t zipEntries = 4;
+    std::size_t maxDepth = 2;
+};
+
+bool ParseMix(const std::string& text, std::vector<unsigned>& weights) {
+    weights.assign(3, 0);
+    std::stringstream stream(text);
+    std::string pair;
+    while (std::getline(stream, pair, ',')) {
+        std::string::size_type equals = pair.find('=');
+        if (equals == std::string::npos) return false;
+        std::string name = pair.substr(0, equals);
+        std::size_t weight = 0;
+        if (!ParseCount(pair.substr(equals + 1), weight, 1000000, true)) return false;
+        if (name == "jpg") weights[0] = static_cast<unsigned>(weight);
+        else if (name == "json") weights[1] = static_cast<unsigned>(weight);
+        else if (name == "zip") weights[2] = static_cast<unsigned>(weight);
+        else return false;
+    }
+    return weights[0] + weights[1] + weights[2] > 0;
+}
+
+// Parses a byte size (K/M/G suffixes) of at most kMaxFileBytes.
+bool ParseFileSize(const std::string& text, std::size_t& out) {
+    return ParseByteSize(text, out) && out <= kMaxFileBytes;
+}
+
+bool ParseSizes(const std::string& text, SizeDistribution& sizes) {
+    std::vector<std::string> parts;
+    std::stringstream stream(text);
+    std::string part;
+    while (std::getline(stream, part, ':')) parts.push_back(part);
+
+    std::size_t first = 0;
+    std::size_t second = 0;
+    if (parts.size() == 2 && parts[0] == "fixed" && ParseFileSize(parts[1], first)) {
+        sizes.shape = SizeDistribution::Shape::FIXED;
+        sizes.first = static_cast<double>(first);
+        return first > 0;
+    }
+    if (parts.size() == 3 && parts[0] == "uniform" && ParseFileSize(parts[1], first) &&
+        ParseFileSize(parts[2], second)) {
+        sizes.shape = SizeDistribution::Shape::UNIFORM;
+        sizes.first = static_cast<double>(first);
+        sizes.second = static_cast<double>(second);
+        return first > 0 && first <= second;
+    }
+    if (parts.size() == 3 && parts[0] == "lognormal" && ParseFileSize(parts[1], first)) {
+        sizes.shape = SizeDistribution::Shape::LOGNORMAL;
+        sizes.first = static_cast<double>(first);
+        char* end = nullptr;
+        sizes.second = std::strtod(parts[2].c_str(), &end);
+        return first > 0 && end != parts[2].c_str() && *end == '\0' && sizes.second >= 0;
+    }
+    return false;
+}
+
+bool ParseOptions(int argc, char* argv[], Options& options) {
+    const std::size_t anyCount = static_cast<std::size_t>(-1);
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--out" && hasValue) options.outDir = argv[++i];
+        else if (arg == "--inputs" && hasValue) options.inputsPath = argv[++i];
+        else if (arg == "--count" && hasValue) {
+            if (!ParseCount(argv[++i], options.count, anyCount, true)) return false;
+        }
+        else if (arg == "--seed" && hasValue) {
+            if (!ParseSeed(argv[++i], options.seed)) return false;
+        }
+        else if (arg == "--zip-entries" && hasValue) {
+            if (!ParseCount(argv[++i], options.zipEntries, kMaxZipEntries)) return false;
+        }
+        else if (arg == "--max-depth" && hasValue) {
+            if (!ParseCount(argv[++i], options.maxDepth, anyCount, true)) return false;
+        }
+        else if (arg == "--mix" && hasValue) {
+            if (!ParseMix(argv[++i], options.weights)) return false;
+        }
+        else if (arg == "--size" && hasValue) {
+            if (!ParseSizes(argv[++i], options.sizes)) return false;
+        }
+        else return false;
+    }
+    return !options.outDir.empty();
+}
+
+FileKind DrawKind(RandomGenerator& random, const std::vector<unsigned>& weights, bool allowZip) {
+    unsigned total = weights[0] + weights[1] + (allowZip ? weights[2] : 0);
+    if (total == 0) return FileKind::JSON; // Only archives requested, but the depth limit is reached.
+    std::uint64_t pick = random.NextBelow(total);
+    if (pick < weights[0]) return FileKind::JPG;
+    if (pick < weights[0] + weights[1]) return FileKind::JSON;
+    return FileKind::ZIP;
+}
+
+void AppendLittleEndian(std::string& out, std::uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) out += static_cast<char>((value >> (8 * i)) & 0xFF);
+}
+
+std::uint32_t Crc32(const std::string& data) {
+    static std::uint32_t table[256];
+    static bool initialized = false;
+    if (!initialized) {
+        for (std::uint32_t n = 0; n < 256; ++n) {
+            std::uint32_t c = n;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+        initialized = true;
+    }
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (unsigned char byte : data) crc = table[(crc ^ byte) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+// 8x8 grayscale baseline JPEG: every block has DC difference 0 and an immediate end-of-block,
+// with one-code Huffman tables, so the image decodes to flat mid-gray.
+std::string MakeJpeg(std::size_t size, RandomGenerator& random) {
+    static const unsigned char head[] = {
+        0xFF, 0xD8,                                                             // SOI
+        0xFF, 0xE0, 0x00, 0x10, 'J', 'F', 'I', 'F', 0x00, 0x01, 0x01, 0x00,     // APP0 (JFIF 1.1)
+        0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+        0xFF, 0xDB, 0x00, 0x43, 0x00 };                                         // DQT table 0 (64 ones follow)
+    static const unsigned char tables[] = {
+        0xFF, 0xC0, 0x00, 0x0B, 0x08, 0x00, 0x08, 0x00, 0x08, 0x01, 0x01, 0x11, 0x00, // SOF0 8x8, 1 component
+        0xFF, 0xC4, 0x00, 0x14, 0x00, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x00, // DHT DC 0
+        0xFF, 0xC4, 0x00, 0x14, 0x10, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x00, // DHT AC 0
+        0xFF, 0xDA, 0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3F, 0x00,                     // SOS
+        0x3F,                                                                           // Scan: DC 0, EOB
+        0xFF, 0xD9 };                                                                   // EOI
+
+    std::string jpeg(reinterpret_cast<const char*>(head), sizeof(head));
+    jpeg.append(64, '\x01');
+
+    // Pad with comment segments (each at most 65533 payload bytes) up to the requested size.
+    std::size_t fixed = jpeg.size() + sizeof(tables);
+    std::size_t padding = size > fixed ? size - fixed : 0;
+    while (padding >= 4 + 1) {
+        std::size_t payload = padding - 4 < 65533 ? padding - 4 : 65533;
+        jpeg += "\xFF\xFE";
+        jpeg += static_cast<char>(((payload + 2) >> 8) & 0xFF);
+        jpeg += static_cast<char>((payload + 2) & 0xFF);
+        for (std::size_t i = 0; i < payload; ++i) jpeg += static_cast<char>('a' + random.NextBelow(26));
+        padding -= payload + 4;
+    }
+    jpeg.append(reinterpret_cast<const char*>(tables), sizeof(tables));
+    return jpeg;
+}
+
+std::string MakeJson(std::size_t size, RandomGenerator& random) {
+    std::string json = "{\"records\":[";
+    for (std::size_t id = 0; json.size() + 64 < size; ++id) {
+        if (id > 0) json += ',';
+        json += "{\"id\":" + std::to_string(id) + ",\"value\":" + std::to_string(random.NextBelow(1000000)) +
+                ",\"tag\":\"t" + std::to_string(random.NextBelow(100)) + "\"}";
+    }
+    json += "],\"padding\":\"";
+    if (json.size() + 3 < size) json.append(size - json.size() - 3, 'x');
+    json += "\"}\n";
+    return json;
+}
+
+std::string MakeFile(FileKind kind, std::size_t size, std::size_t depth, const Options& options,
+                     RandomGenerator& random);
+
+// Stored ZIP archive whose entries share `size` and follow the type mix. Returns an empty string when
+// the archive (or a nested one) would exceed kMaxFileBytes, which 32-bit ZIP offsets cannot address.
+std::string MakeZip(std::size_t size, std::size_t depth, const Options& options, RandomGenerator& random) {
+    std::string archive;
+    std::string directory;
+    std::size_t entrySize = size / options.zipEntries > 0 ? size / options.zipEntries : 1;
+    for (std::size_t i = 0; i < options.zipEntries; ++i) {
+        FileKind kind = DrawKind(random, options.weights, depth + 1 < options.maxDepth);
+        std::string name = "entry" + std::to_string(i) + Extension(kind);
+        std::string data = MakeFile(kind, entrySize, depth + 1, options, random);
+        if (data.empty() || archive.size() + data.size() + 2 * name.size() + 76 > kMaxFileBytes) return std::string();
+        std::uint32_t crc = Crc32(data);
+        std::uint32_t offset = static_cast<std::uint32_t>(archive.size());
+        std::uint32_t length = static_cast<std::uint32_t>(data.size());
+
+        // Local file header (version 2.0, stored, fixed 1980-01-01 timestamp for reproducible bytes).
+        AppendLittleEndian(archive, 0x04034B50u, 4);
+        AppendLittleEndian(archive, 20, 2);
+        AppendLittleEndian(archive, 0, 2);
+        AppendLittleEndian(archive, 0, 2);
+        AppendLittleEndian(archive, 0, 2);
+        AppendLittleEndian(archive, 0x21, 2);
+        AppendLittleEndian(archive, crc, 4);
+        AppendLittleEndian(archive, length, 4);
+        AppendLittleEndian(archive, length, 4);
+        AppendLittleEndian(archive, static_cast<std::uint32_t>(name.size()), 2);
+        AppendLittleEndian(archive, 0, 2);
+        archive += name;
+        archive += data;
+
+        // Central directory entry.
+        AppendLittleEndian(directory, 0x02014B50u, 4);
+        AppendLittleEndian(directory, 20, 2);
+        AppendLittleEndian(directory, 20, 2);
+        AppendLittleEndian(directory, 0, 2);
+        AppendLittleEndian(directory, 0, 2);
+        AppendLittleEndian(directory, 0, 2);
+        AppendLittleEndian(directory, 0x21, 2);
+        AppendLittleEndian(directory, crc, 4);
+        AppendLittleEndian(directory, length, 4);
+        AppendLittleEndian(directory, length, 4);
+        AppendLittleEndian(directory, static_cast<std::uint32_t>(name.size()), 2);
+        AppendLittleEndian(directory, 0, 2);
+        AppendLittleEndian(directory, 0, 2);
+        AppendLittleEndian(directory, 0, 2);
+        AppendLittleEndian(directory, 0, 2);
+        AppendLittleEndian(directory, 0, 4);
+        AppendLittleEndian(directory, offset, 4);
+        directory += name;
+    }
+
+    if (archive.size() + directory.size() + 22 > kMaxFileBytes) return std::string();
+    std::uint32_t directoryOffset = static_cast<std::uint32_t>(archive.size());
+    archive += directory;
+    AppendLittleEndian(archive, 0x06054B50u, 4); // End of central directory.
+    AppendLittleEndian(archive, 0, 2);
+    AppendLittleEndian(archive, 0, 2);
+    AppendLittleEndian(archive, static_cast<std::uint32_t>(options.zipEntries), 2);
+    AppendLittleEndian(archive, static_cast<std::uint32_t>(options.zipEntries), 2);
+    AppendLittleEndian(archive, static_cast<std::uint32_t>(directory.size()), 4);
+    AppendLittleEndian(archive, directoryOffset, 4);
+    AppendLittleEndian(archive, 0, 2);
+    return archive;
+}
+
+std::string MakeFile(FileKind kind, std::size_t size, std::size_t depth, const Options& options,
+                     RandomGenerator& random) {
+    if (kind == FileKind::JPG) return MakeJpeg(size, random);
+    if (kind == FileKind::JSON) return MakeJson(size, random);
+    return MakeZip(size, depth, options, random);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        std::cerr << "Usage: " << argv[0] << " --out DIR [--count N] [--seed N] [--mix jpg=40,json=40,zip=20]\n"
+                  << "       [--size fixed:SIZE | uniform:MIN:MAX | lognormal:MEDIAN:SIGMA]"
+                  << " [--zip-entries N] [--max-depth N] [--inputs FILE]\n";
+        return 1;
+    }
+    if (options.inputsPath.empty()) options.inputsPath = options.outDir + "/inputs.txt";
+    if (::mkdir(options.outDir.c_str(), 0755) != 0 && errno != EEXIST) {
+        std::cerr << "Cannot create directory: " << options.outDir << "\n";
+        return 1;
+    }
+
+    std::ofstream inputs(options.inputsPath, std::ios::trunc);
+    if (!inputs) {
+        std::cerr << "Cannot write inputs file: " << options.inputsPath << "\n";
+        return 1;
+    }
+    inputs << "# ComputePipeline inputs (LoadGenerator)\n# seed: " << options.seed << "\n";
+
+    std::size_t totalBytes = 0;
+    std::size_t kindCounts[3] = { 0, 0, 0 };
+    for (std::size_t i = 0; i < options.count; ++i) {
+        // One generator per file, so a file depends only on the seed and its index.
+        RandomGenerator random(MixSeed(options.seed, i));
+        FileKind kind = DrawKind(random, options.weights, options.maxDepth > 0);
+        std::string data = MakeFile(kind, options.sizes.Draw(random), 0, options, random);
+        if (data.empty()) {
+            std::cerr << "Archive " << i << " would exceed 4 GiB (ZIP64 is not supported); "
+                      << "use smaller sizes, fewer --zip-entries or a lower --max-depth\n";
+            return 1;
+        }
+
+        std::string path = options.outDir + "/input" + std::to_string(i) + Extension(kind);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.write(data.data(), static_cast<std::streamsize>(data.size()))) {
+            std::cerr << "Cannot write file: " << path << "\n";
+            return 1;
+        }
+        inputs << "file://" << path << "\n";
+        totalBytes += data.size();
+        ++kindCounts[static_cast<int>(kind)];
+    }
+    if (!inputs.flush()) {
+        std::cerr << "Cannot write inputs file: " << options.inputsPath << "\n";
+        return 1;
+    }
+
+    std::cout << "Wrote " << options.count << " files (" << kindCounts[0] << " jpg, " << kindCounts[1] << " json, "
+              << kindCounts[2] << " zip), " << totalBytes << " bytes, to " << options.outDir << "\n";
+    std::cout << "Replay with: ComputePipeline --inputs " << options.inputsPath << "\n";
+    return 0;
+}
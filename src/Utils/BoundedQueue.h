@@ -0,0 +1,149 @@
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * BoundedQueue Class
+ * ------------------
+ * Thread-safe FIFO queue with a fixed capacity, used to connect pipeline stages.
+ *
+ * Responsibilities:
+ * - Blocks producers when the queue is full (backpressure between stages).
+ * - Blocks consumers when the queue is empty, until an item arrives or the queue is closed.
+ * - Supports popping items in batches to amortize synchronization per stage.
+ * - Works with move-only element types such as ActionResult.
+ * - Optionally splits its items into partitions (e.g., one per NUMA node). Every item gets a
+ *   sequence number; PopBatch takes the oldest items across all partitions, PopBatchPreferring
+ *   takes from one partition first but never lets an item be overtaken by more than `maxSkips`
+ *   younger ones. Both only look at the partition heads, so a pop costs O(partitions).
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    /**
+     * Constructor
+     * -----------
+     * Parameters:
+     * - capacity (std::size_t): Maximum number of queued items in all partitions (values below 1 are treated as 1).
+     * - partitions (std::size_t): Number of partitions (values below 1 are treated as 1).
+     */
+    explicit BoundedQueue(std::size_t capacity, std::size_t partitions = 1)
+        : capacity(capacity > 0 ? capacity : 1), closed(false), count(0), nextSequence(0),
+          items(partitions > 0 ? partitions : 1) {
+    }
+
+    /**
+     * Push Method
+     * -----------
+     * Appends an item to a partition, blocking while the queue is full.
+     *
+     * Returns:
+     * - bool: false if the queue was closed (the item is dropped), true otherwise.
+     */
+    bool Push(T value, std::size_t partition = 0) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this] { return closed || count < capacity; });
+        if (closed) return false;
+        items[partition < items.size() ? partition : 0].push_back(Entry{ nextSequence++, std::move(value) });
+        ++count;
+        notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * PopBatch Method
+     * ---------------
+     * Moves up to `maxItems` items into `out`, oldest first, blocking until at least one item is available.
+     *
+     * Returns:
+     * - bool: false once the queue is closed and drained, true otherwise.
+     */
+    bool PopBatch(std::vector<T>& out, std::size_t maxItems) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this] { return closed || count > 0; });
+        if (count == 0) return false;
+        if (maxItems == 0) maxItems = 1;
+        while (count > 0 && maxItems-- > 0) Take(out, Oldest());
+        notFull.notify_all();
+        return true;
+    }
+
+    /**
+     * PopBatchPreferring Method
+     * -------------------------
+     * Like PopBatch, but takes items from `partition` first, in FIFO order. The oldest item of another
+     * partition is taken instead when `partition` is empty (stealing), and when the next preferred item
+     * is more than `maxSkips` pushes younger than it, so at most `maxSkips` younger items overtake it.
+     *
+     * Returns:
+     * - bool: false once the queue is closed and drained, true otherwise.
+     */
+    bool PopBatchPreferring(std::vector<T>& out, std::size_t maxItems, std::size_t partition, std::size_t maxSkips) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this] { return closed || count > 0; });
+        if (count == 0) return false;
+        if (maxItems == 0) maxItems = 1;
+        if (partition >= items.size()) partition = 0;
+        while (count > 0 && maxItems-- > 0) {
+            std::size_t oldest = Oldest();
+            const std::deque<Entry>& preferred = items[partition];
+            bool takePreferred = !preferred.empty() &&
+                                 preferred.front().sequence - items[oldest].front().sequence <= maxSkips;
+            Take(out, takePreferred ? partition : oldest);
+        }
+        notFull.notify_all();
+        return true;
+    }
+
+    /**
+     * Close Method
+     * ------------
+     * Closes the queue. Pending items can still be popped; further pushes fail.
+     */
+    void Close() {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        notEmpty.notify_all();
+        notFull.notify_all();
+    }
+
+private:
+    struct Entry {
+        std::uint64_t sequence; // Push order across all partitions.
+        T value;
+    };
+
+    // Returns the non-empty partition whose head was pushed first (requires count > 0).
+    std::size_t Oldest() const {
+        std::size_t oldest = items.size();
+        for (std::size_t i = 0; i < items.size(); ++i) {
+            if (items[i].empty()) continue;
+            if (oldest == items.size() || items[i].front().sequence < items[oldest].front().sequence) oldest = i;
+        }
+        return oldest;
+    }
+
+    void Take(std::vector<T>& out, std::size_t partition) {
+        out.push_back(std::move(items[partition].front().value));
+        items[partition].pop_front();
+        --count;
+    }
+
+    std::size_t capacity;                 // Maximum number of queued items.
+    bool closed;                          // Set once no more items will be pushed.
+    std::size_t count;                    // Queued items in all partitions.
+    std::uint64_t nextSequence;           // Sequence number of the next pushed item.
+    std::vector<std::deque<Entry>> items; // Queued items per partition, each in FIFO order.
+    std::mutex mutex;                     // Guards all members above.
+    std::condition_variable notEmpty;     // Signalled when an item is pushed or the queue closes.
+    std::condition_variable notFull;      // Signalled when items are popped or the queue closes.
+};
+
+#endif
@@ -0,0 +1,209 @@
+#ifndef COROUTINE_SCHEDULER_H
+#define COROUTINE_SCHEDULER_H
+
+#ifdef COMPUTE_PIPELINE_COROUTINES
+
+#include "../Core/CancellationToken.h" // Cancellable timers.
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * CoroutineScheduler Class (C++20)
+ * --------------------------------
+ * Runs coroutines on a small, fixed pool of worker threads.
+ *
+ * Responsibilities:
+ * - Resumes posted coroutine handles on the worker threads (FIFO).
+ * - Keeps a timer queue so that a coroutine waiting on simulated I/O (SleepFor) is suspended
+ *   without holding a thread, and is posted again when its deadline passes or, for a timer with a
+ *   cancellation token, once the token is cancelled (checked every kCancellationPollInterval).
+ * - Exposes the scheduler of the current worker thread (Current), so awaitables can find it.
+ */
+class CoroutineScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Constructor
+     * -----------
+     * Parameters:
+     * - threads (std::size_t): Number of worker threads (at least 1).
+     */
+    explicit CoroutineScheduler(std::size_t threads) : stopping(false) {
+        if (threads == 0) threads = 1;
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers.emplace_back([this] { WorkerLoop(); });
+        }
+        timerThread = std::thread([this] { TimerLoop(); });
+    }
+
+    /**
+     * Destructor
+     * ----------
+     * Stops the workers once the ready queue is drained and joins all threads.
+     * Coroutines still waiting on timers are not resumed.
+     */
+    ~CoroutineScheduler() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        readySignal.notify_all();
+        timerSignal.notify_all();
+        for (auto& worker : workers) worker.join();
+        timerThread.join();
+    }
+
+    CoroutineScheduler(const CoroutineScheduler&) = delete;
+    CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+
+    /**
+     * Post Method
+     * -----------
+     * Queues a coroutine to be resumed on a worker thread.
+     */
+    void Post(std::coroutine_handle<> handle) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ready.push_back(handle);
+        }
+        readySignal.notify_one();
+    }
+
+    /**
+     * PostAt Method
+     * -------------
+     * Queues a coroutine to be resumed once `deadline` has passed, or earlier once `cancellation`
+     * is cancelled.
+     */
+    void PostAt(Clock::time_point deadline, std::coroutine_handle<> handle,
+                const CancellationToken& cancellation = CancellationToken()) {
+        Timer timer{ deadline, deadline, handle, cancellation };
+        if (cancellation.CanBeCancelled()) timer.wake = std::min(deadline, Clock::now() + kCancellationPollInterval);
+        bool earliest = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            earliest = timers.empty() || timer.wake < timers.top().wake;
+            timers.push(std::move(timer));
+        }
+        if (earliest) timerSignal.notify_one();
+    }
+
+    /**
+     * Returns the scheduler running the calling thread, or nullptr outside of a scheduler.
+     */
+    static CoroutineScheduler*& Current() {
+        thread_local CoroutineScheduler* current = nullptr;
+        return current;
+    }
+
+private:
+    struct Timer {
+        Clock::time_point wake;         // Next time the timer is looked at.
+        Clock::time_point deadline;     // Resume time when not cancelled.
+        std::coroutine_handle<> handle;
+        CancellationToken cancellation; // Checked at every wake before the deadline.
+        bool operator>(const Timer& other) const { return wake > other.wake; }
+    };
+
+    void WorkerLoop() {
+        Current() = this;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            readySignal.wait(lock, [this] { return stopping || !ready.empty(); });
+            if (ready.empty()) return;
+            std::coroutine_handle<> handle = ready.front();
+            ready.pop_front();
+            lock.unlock();
+            handle.resume();
+            lock.lock();
+        }
+    }
+
+    void TimerLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopping) {
+            if (timers.empty()) {
+                timerSignal.wait(lock);
+                continue;
+            }
+            Clock::time_point wake = timers.top().wake;
+            if (Clock::now() < wake) {
+                timerSignal.wait_until(lock, wake);
+                continue;
+            }
+            // Move every due or cancelled timer to the ready queue; re-arm the others one slice later.
+            Clock::time_point now = Clock::now();
+            bool resumed = false;
+            while (!timers.empty() && timers.top().wake <= now) {
+                Timer timer = timers.top();
+                timers.pop();
+                if (timer.wake < timer.deadline && !timer.cancellation.IsCancelled()) {
+                    timer.wake = std::min(timer.deadline, now + kCancellationPollInterval);
+                    timers.push(std::move(timer));
+                    continue;
+                }
+                ready.push_back(timer.handle);
+                resumed = true;
+            }
+            if (resumed) readySignal.notify_all();
+        }
+    }
+
+    std::mutex mutex;                                  // Guards ready, timers and stopping.
+    std::condition_variable readySignal;               // Signalled when a handle becomes ready.
+    std::condition_variable timerSignal;               // Signalled when an earlier timer is added.
+    std::deque<std::coroutine_handle<>> ready;         // Handles waiting for a worker.
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers; // Earliest deadline first.
+    bool stopping;                                     // Set by the destructor.
+    std::vector<std::thread> workers;                  // Worker threads resuming coroutines.
+    std::thread timerThread;                           // Thread moving due timers to the ready queue.
+};
+
+/**
+ * SleepFor Awaitable (C++20)
+ * --------------------------
+ * Suspends the awaiting coroutine for `delay` without blocking its thread when it runs on a
+ * CoroutineScheduler; outside of a scheduler it falls back to a blocking sleep. Either way the
+ * sleep ends early (within kCancellationPollInterval) once `cancellation` is cancelled; the
+ * awaiting coroutine checks the token itself after resuming.
+ *
+ * Await a named SleepFor rather than a temporary: GCC 12 destroys a brace-initialized temporary
+ * awaiter twice, which would release the token's shared state twice.
+ */
+struct SleepFor {
+    std::chrono::milliseconds delay;
+    CancellationToken cancellation = CancellationToken();
+
+    bool await_ready() const noexcept { return delay.count() <= 0 || cancellation.IsCancelled(); }
+
+    bool await_suspend(std::coroutine_handle<> handle) const {
+        CoroutineScheduler::Clock::time_point end = CoroutineScheduler::Clock::now() + delay;
+        CoroutineScheduler* scheduler = CoroutineScheduler::Current();
+        if (scheduler == nullptr) {
+            for (CoroutineScheduler::Clock::time_point now = CoroutineScheduler::Clock::now();
+                 now < end && !cancellation.IsCancelled(); now = CoroutineScheduler::Clock::now()) {
+                std::this_thread::sleep_for(std::min<CoroutineScheduler::Clock::duration>(end - now, kCancellationPollInterval));
+            }
+            return false; // Resume immediately.
+        }
+        scheduler->PostAt(end, handle, cancellation);
+        return true;
+    }
+
+    void await_resume() const noexcept {}
+};
+
+#endif // COMPUTE_PIPELINE_COROUTINES
+
+#endif
@@ -0,0 +1,189 @@
+#ifndef CPU_TOPOLOGY_H
+#define CPU_TOPOLOGY_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#if defined(COMPUTE_PIPELINE_NUMA)
+#include <numa.h>
+#endif
+
+/**
+ * CpuTopology Utility
+ * -------------------
+ * NUMA nodes and the CPUs of each node that this process may run on, used to pin pipeline workers.
+ *
+ * Detection Order:
+ * - libnuma (when built with COMPUTE_PIPELINE_NUMA and numa_available() succeeds).
+ * - /sys/devices/system/node/node<N>/cpulist (Linux without libnuma).
+ * - A single node holding every allowed CPU (single-node machines, other platforms).
+ *
+ * CPUs outside the process affinity mask (e.g., taskset or cgroup limits) are dropped, and nodes
+ * left without CPUs are skipped, so node indices here are dense and may differ from the OS numbering.
+ */
+class CpuTopology {
+public:
+    /**
+     * Detect Method (Static)
+     * ----------------------
+     * Reads the topology of the current machine (see Detection Order above). Never returns an
+     * empty topology: if nothing can be read, it holds one node with CPU 0.
+     */
+    static CpuTopology Detect() {
+        CpuTopology topology;
+        std::vector<int> allowed = AllowedCpus();
+
+#if defined(COMPUTE_PIPELINE_NUMA)
+        if (numa_available() >= 0) {
+            for (int node = 0; node <= numa_max_node(); ++node) {
+                struct bitmask* mask = numa_allocate_cpumask();
+                if (numa_node_to_cpus(node, mask) == 0) {
+                    std::vector<int> cpus;
+                    for (int cpu : allowed) {
+                        if (numa_bitmask_isbitset(mask, static_cast<unsigned int>(cpu))) cpus.push_back(cpu);
+                    }
+                    topology.AddNode(node, cpus);
+                }
+                numa_free_cpumask(mask);
+            }
+        }
+#endif
+#if defined(__linux__)
+        if (topology.nodes.empty()) {
+            for (int node : ParseCpuList(ReadLine("/sys/devices/system/node/online"))) {
+                std::string list = ReadLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+                topology.AddNode(node, Intersect(ParseCpuList(list), allowed));
+            }
+        }
+#endif
+        if (topology.nodes.empty()) topology.AddNode(0, allowed);
+        if (topology.nodes.empty()) topology.AddNode(0, std::vector<int>(1, 0));
+        return topology;
+    }
+
+    /**
+     * Returns the number of nodes with at least one usable CPU (at least 1).
+     */
+    std::size_t NodeCount() const { return nodes.size(); }
+
+    /**
+     * Returns the usable CPUs of node `node` (0 <= node < NodeCount()).
+     */
+    const std::vector<int>& CpusOf(std::size_t node) const { return nodes[node].cpus; }
+
+    /**
+     * CpuFor Method
+     * -------------
+     * Spreads workers over a node: worker `slot` of the node gets the node's CPUs in turn.
+     */
+    int CpuFor(std::size_t node, std::size_t slot) const {
+        const std::vector<int>& cpus = nodes[node].cpus;
+        return cpus[slot % cpus.size()];
+    }
+
+    /**
+     * PinCurrentThread Method
+     * -----------------------
+     * Binds the calling thread to CPU `cpu` of node `node` and, with libnuma, makes that node
+     * the preferred node for the thread's allocations. Without libnuma the kernel's first-touch
+     * policy places pages the pinned thread writes first on its own node.
+     *
+     * Returns:
+     * - bool: false if the platform does not support pinning or the call failed; the thread then
+     *   keeps running unpinned.
+     */
+    bool PinCurrentThread(std::size_t node, int cpu) const {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (sched_setaffinity(0, sizeof(set), &set) != 0) return false;
+#if defined(COMPUTE_PIPELINE_NUMA)
+        if (numa_available() >= 0) numa_set_preferred(nodes[node].osNode);
+#else
+        (void)node;
+#endif
+        return true;
+#else
+        (void)node;
+        (void)cpu;
+        return false;
+#endif
+    }
+
+private:
+    struct Node {
+        int osNode;            // Node number used by the operating system.
+        std::vector<int> cpus; // Usable CPUs of the node.
+    };
+
+    void AddNode(int osNode, std::vector<int> cpus) {
+        if (!cpus.empty()) nodes.push_back(Node{ osNode, std::move(cpus) });
+    }
+
+    // CPUs in the process affinity mask (all hardware threads where the mask is not available).
+    static std::vector<int> AllowedCpus() {
+        std::vector<int> cpus;
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+            }
+            return cpus;
+        }
+#endif
+        unsigned int count = std::thread::hardware_concurrency();
+        for (unsigned int cpu = 0; cpu < (count > 0 ? count : 1); ++cpu) cpus.push_back(static_cast<int>(cpu));
+        return cpus;
+    }
+
+    static std::string ReadLine(const std::string& path) {
+        std::ifstream file(path);
+        std::string line;
+        std::getline(file, line);
+        return line;
+    }
+
+    // Parses a kernel CPU or node list such as "0-3,8-11".
+    static std::vector<int> ParseCpuList(const std::string& list) {
+        std::vector<int> cpus;
+        std::stringstream stream(list);
+        std::string range;
+        while (std::getline(stream, range, ',')) {
+            if (range.empty()) continue;
+            std::string::size_type dash = range.find('-');
+            int first = std::atoi(range.substr(0, dash).c_str());
+            int last = (dash == std::string::npos) ? first : std::atoi(range.substr(dash + 1).c_str());
+            for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+        }
+        return cpus;
+    }
+
+    static std::vector<int> Intersect(const std::vector<int>& cpus, const std::vector<int>& allowed) {
+        std::vector<int> result;
+        for (int cpu : cpus) {
+            for (int permitted : allowed) {
+                if (cpu == permitted) {
+                    result.push_back(cpu);
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+    std::vector<Node> nodes; // Nodes with at least one usable CPU.
+};
+
+#endif
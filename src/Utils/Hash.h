@@ -0,0 +1,43 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Hash Utility
+ * ------------
+ * 64-bit FNV-1a, the one non-cryptographic hash used across the pipeline (random keys, manifest run
+ * contexts, file contents). Keeping a single definition guarantees that every caller hashing the same
+ * bytes gets the same value, which persisted manifests depend on.
+ */
+
+constexpr std::uint64_t kFnv1aOffsetBasis = 14695981039346656037ull;
+constexpr std::uint64_t kFnv1aPrime = 1099511628211ull;
+
+/**
+ * Fnv1a Function
+ * --------------
+ * Folds `size` bytes into an FNV-1a hash.
+ *
+ * Parameters:
+ * - data (const void*): The bytes to hash.
+ * - size (std::size_t): Number of bytes.
+ * - hash (std::uint64_t): Hash of the preceding bytes, so data can be hashed in chunks; defaults to
+ *   the offset basis (start of a new hash).
+ */
+inline std::uint64_t Fnv1a(const void* data, std::size_t size, std::uint64_t hash = kFnv1aOffsetBasis) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= kFnv1aPrime;
+    }
+    return hash;
+}
+
+inline std::uint64_t Fnv1a(const std::string& text, std::uint64_t hash = kFnv1aOffsetBasis) {
+    return Fnv1a(text.data(), text.size(), hash);
+}
+
+#endif
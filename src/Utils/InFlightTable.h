@@ -0,0 +1,143 @@
+#ifndef IN_FLIGHT_TABLE_H
+#define IN_FLIGHT_TABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * InFlightTable Class
+ * -------------------
+ * Sharded, thread-safe table of the sources currently being loaded or processed.
+ * Used to coalesce duplicate requests: the first request for a source becomes its leader and does the
+ * work, requests for the same source that arrive while it is in flight are attached to the leader and
+ * share its result.
+ *
+ * Responsibilities:
+ * - Hashes each source to one of `shardCount` shards, each guarded by its own mutex.
+ * - Records which request indices are waiting on a leader.
+ * - Drops a source's entry as soon as its leader completes and hands back the waiters, so the table
+ *   only ever holds sources in flight. A request arriving after that becomes a new leader.
+ * - Counts leaders and coalesced requests.
+ */
+class InFlightTable {
+public:
+    /**
+     * Claim Enum
+     * ----------
+     * Outcome of Acquire for a request.
+     *
+     * Values:
+     * - LEADER    -> No request for the source is in flight; the caller must do the work and call Complete.
+     * - WAITING   -> The source is in flight; the request was attached to the leader.
+     */
+    enum class Claim { LEADER, WAITING };
+
+    /**
+     * Constructor
+     * -----------
+     * Parameters:
+     * - shardCount (std::size_t): Number of independently locked shards (at least 1).
+     */
+    explicit InFlightTable(std::size_t shardCount = 16)
+        : shards(shardCount > 0 ? shardCount : 1), leaders(0), coalesced(0) {
+    }
+
+    /**
+     * Acquire Method
+     * --------------
+     * Claims a source for the request `index`.
+     *
+     * Parameters:
+     * - source (const std::string&): The source being requested.
+     * - index (std::size_t): The request's index in the input list.
+     *
+     * Returns:
+     * - Claim: LEADER or WAITING (see Claim).
+     */
+    Claim Acquire(const std::string& source, std::size_t index) {
+        Shard& shard = ShardFor(source);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto found = shard.entries.find(source);
+        if (found == shard.entries.end()) {
+            Entry entry;
+            entry.leader = index;
+            shard.entries.emplace(source, std::move(entry));
+            leaders.fetch_add(1, std::memory_order_relaxed);
+            return Claim::LEADER;
+        }
+
+        coalesced.fetch_add(1, std::memory_order_relaxed);
+        found->second.waiters.push_back(index);
+        return Claim::WAITING;
+    }
+
+    /**
+     * Complete Method
+     * ---------------
+     * Marks the source as finished and drops its entry. The leader's result must be published before
+     * calling this; the caller serves the returned waiters from it.
+     *
+     * Returns:
+     * - std::vector<std::size_t>: The request indices that were waiting on the leader.
+     */
+    std::vector<std::size_t> Complete(const std::string& source) {
+        Shard& shard = ShardFor(source);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        std::vector<std::size_t> waiters;
+        auto found = shard.entries.find(source);
+        if (found == shard.entries.end()) return waiters;
+        waiters.swap(found->second.waiters);
+        shard.entries.erase(found);
+        return waiters;
+    }
+
+    /**
+     * Returns the number of sources currently in flight.
+     */
+    std::size_t InFlightCount() const {
+        std::size_t count = 0;
+        for (const Shard& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            count += shard.entries.size();
+        }
+        return count;
+    }
+
+    /**
+     * Returns the number of requests that did the work themselves (one per distinct source).
+     */
+    std::size_t LeaderCount() const { return leaders.load(std::memory_order_relaxed); }
+
+    /**
+     * Returns the number of requests that reused another request's work.
+     */
+    std::size_t CoalescedCount() const { return coalesced.load(std::memory_order_relaxed); }
+
+private:
+    struct Entry {
+        std::size_t leader;               // Request index doing the work.
+        std::vector<std::size_t> waiters; // Requests attached while in flight.
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, Entry> entries;
+    };
+
+    Shard& ShardFor(const std::string& source) {
+        return shards[std::hash<std::string>()(source) % shards.size()];
+    }
+
+    std::vector<Shard> shards;
+    std::atomic<std::size_t> leaders;
+    std::atomic<std::size_t> coalesced;
+};
+
+#endif
@@ -0,0 +1,422 @@
+#ifndef INCREMENTAL_MANIFEST_H
+#define INCREMENTAL_MANIFEST_H
+
+#include "../Core/ActionResult.h"  // Core structure for processing results.
+#include "../Utils/Hash.h"         // FNV-1a for file contents and run contexts.
+#include <cctype>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <sys/stat.h>
+
+/**
+ * IncrementalManifest Utility
+ * ---------------------------
+ * Persistent record of processed file:// sources, used to skip unchanged files on the next run.
+ *
+ * Each entry stores the file's size, modification time and content hash, taken before the file
+ * was loaded, together with the result of processing it (final source, type, content and metadata)
+ * and the run context it was produced under (stage graph and seed). On the next run a source whose
+ * context, size and mtime still match (and, on request, whose content hash still matches) is
+ * restored from the manifest without calling ILoader::Load or PipelineManager::Process.
+ *
+ * Manifest Format:
+ * - A header line "ComputePipeline manifest 2", then one tab-separated line per source:
+ *   source, context (hex), size, mtime (ns), hash (hex), final source, type, content,
+ *   processed (0/1), metadata count, then alternating metadata keys and values.
+ * - Tabs, newlines and backslashes inside fields are escaped as \t, \n and \\.
+ * - A manifest written by an older format version is discarded (every source is processed again).
+ */
+
+/**
+ * FileFingerprint Struct
+ * ----------------------
+ * Cheap change-detection data for a file, taken from stat().
+ */
+struct FileFingerprint {
+    std::uint64_t size = 0;
+    std::int64_t mtimeNs = 0;
+};
+
+/**
+ * FileState Struct
+ * ----------------
+ * Fingerprint and content hash of a file, captured before it is loaded and later passed to
+ * IncrementalManifest::Record, so a file that changes while it is processed is not recorded as unchanged.
+ */
+struct FileState {
+    FileFingerprint fingerprint;
+    std::uint64_t hash = 0;
+};
+
+/**
+ * FilePathFromSource Function
+ * ---------------------------
+ * Returns the local path of a file:// source, or an empty string for other protocols.
+ */
+inline std::string FilePathFromSource(const std::string& source) {
+    static const char prefix[] = "file://";
+    if (source.compare(0, sizeof(prefix) - 1, prefix) != 0) return std::string();
+    return source.substr(sizeof(prefix) - 1);
+}
+
+/**
+ * StatFile Function
+ * -----------------
+ * Reads the size and modification time of a regular file.
+ *
+ * Returns:
+ * - bool: false if the file does not exist or is not a regular file.
+ */
+inline bool StatFile(const std::string& path, FileFingerprint& fingerprint) {
+    struct stat info;
+    if (::stat(path.c_str(), &info) != 0 || !S_ISREG(info.st_mode)) return false;
+    fingerprint.size = static_cast<std::uint64_t>(info.st_size);
+#if defined(__APPLE__)
+    fingerprint.mtimeNs = static_cast<std::int64_t>(info.st_mtimespec.tv_sec) * 1000000000 + info.st_mtimespec.tv_nsec;
+#else
+    fingerprint.mtimeNs = static_cast<std::int64_t>(info.st_mtim.tv_sec) * 1000000000 + info.st_mtim.tv_nsec;
+#endif
+    return true;
+}
+
+/**
+ * HashFile Function
+ * -----------------
+ * Computes the 64-bit FNV-1a hash of a file's contents, reading it in 64 KiB chunks.
+ *
+ * Returns:
+ * - bool: false if the file cannot be read.
+ */
+inline bool HashFile(const std::string& path, std::uint64_t& hash) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    hash = kFnv1aOffsetBasis;
+    std::vector<char> buffer(64 * 1024);
+    while (file) {
+        file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        hash = Fnv1a(buffer.data(), static_cast<std::size_t>(file.gcount()), hash);
+    }
+    return file.eof();
+}
+
+/**
+ * CaptureFileState Function
+ * -------------------------
+ * Stats and hashes the file behind a file:// source (stat first, so a write during hashing changes
+ * the recorded mtime and is detected on the next run).
+ *
+ * Returns:
+ * - bool: false for other protocols or when the file cannot be read.
+ */
+inline bool CaptureFileState(const std::string& source, FileState& state) {
+    std::string path = FilePathFromSource(source);
+    return !path.empty() && StatFile(path, state.fingerprint) && HashFile(path, state.hash);
+}
+
+/**
+ * IncrementalManifest Class
+ * -------------------------
+ * Loads, queries, updates and saves the manifest (see the format above).
+ *
+ * Responsibilities:
+ * - Restores results for unchanged file:// sources recorded under the same run context (Reuse).
+ * - Records pre-load file states and results of sources that were processed in this run (Record);
+ *   stopped results are never recorded.
+ * - Saves atomically (write to a temporary file, then rename).
+ * - Counts reused and reprocessed sources.
+ */
+class IncrementalManifest {
+public:
+    IncrementalManifest() : context(0), reused(0), recorded(0) {
+    }
+
+    /**
+     * SetRunContext Method
+     * --------------------
+     * Sets the context that results of this run depend on besides the file contents: the stage graph
+     * (see DescribeStageGraph) and the run seed. Entries recorded under another context are not reused.
+     */
+    void SetRunContext(const std::string& stageGraph, std::uint64_t seed) {
+        // The seed is hashed least significant byte first, independent of the host byte order.
+        unsigned char seedBytes[8];
+        for (int i = 0; i < 8; ++i) seedBytes[i] = static_cast<unsigned char>(seed >> (8 * i));
+        context = Fnv1a(seedBytes, sizeof(seedBytes), Fnv1a(stageGraph));
+    }
+
+    /**
+     * Load Method
+     * -----------
+     * Reads a manifest file. A missing file is treated as an empty manifest (first run).
+     *
+     * Returns:
+     * - bool: false if the file exists but is not a valid manifest (an error is logged).
+     */
+    bool Load(const std::string& path) {
+        entries.clear();
+        std::ifstream file(path);
+        if (!file) return true;
+
+        std::string line;
+        if (std::getline(file, line) && line != Header() && line.compare(0, 25, "ComputePipeline manifest ") == 0) {
+            std::cerr << "Manifest written by another format version, processing every source again: " << path << "\n";
+            return true;
+        }
+        if (line != Header()) {
+            std::cerr << "Invalid manifest header: " << path << "\n";
+            return false;
+        }
+        std::size_t lineNumber = 1;
+        while (std::getline(file, line)) {
+            ++lineNumber;
+            if (line.empty()) continue;
+            std::string source;
+            Entry entry;
+            if (!ParseLine(line, source, entry)) {
+                std::cerr << "Invalid manifest entry at line " << lineNumber << ": " << path << "\n";
+                return false;
+            }
+            entries[source] = std::move(entry);
+        }
+        return true;
+    }
+
+    /**
+     * Save Method
+     * -----------
+     * Writes the manifest to `path` atomically.
+     *
+     * Returns:
+     * - bool: true on success; on failure an error is logged.
+     */
+    bool Save(const std::string& path) const {
+        std::string temporary = path + ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::trunc);
+            if (!file) {
+                std::cerr << "Cannot write manifest: " << temporary << "\n";
+                return false;
+            }
+            file << Header() << "\n";
+            for (const auto& pair : entries) WriteLine(file, pair.first, pair.second);
+            if (!file.flush()) {
+                std::cerr << "Cannot write manifest: " << temporary << "\n";
+                return false;
+            }
+        }
+        if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+            std::cerr << "Cannot replace manifest: " << path << "\n";
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Reuse Method
+     * ------------
+     * Restores the recorded result of a source if it was recorded under the current run context and
+     * the file is unchanged.
+     *
+     * Parameters:
+     * - source (const std::string&): The input source (only file:// sources can be reused).
+     * - verifyHash (bool): Also re-hash the file contents and compare with the recorded hash.
+     *
+     * Returns:
+     * - std::unique_ptr<ActionResult>: The restored result, or nullptr if the source must be processed.
+     */
+    std::unique_ptr<ActionResult> Reuse(const std::string& source, bool verifyHash) {
+        auto found = entries.find(source);
+        if (found == entries.end()) return nullptr;
+        const Entry& entry = found->second;
+        if (entry.context != context) return nullptr;
+
+        FileFingerprint current;
+        if (!StatFile(FilePathFromSource(source), current)) return nullptr;
+        if (current.size != entry.fingerprint.size || current.mtimeNs != entry.fingerprint.mtimeNs) return nullptr;
+        if (verifyHash) {
+            std::uint64_t hash = 0;
+            if (!HashFile(FilePathFromSource(source), hash) || hash != entry.hash) return nullptr;
+        }
+
+        std::unique_ptr<ActionResult> item(
+            new ActionResult(entry.type, entry.finalSource, "file"_sr, StringRef(entry.content)));
+        item->isProcessed = entry.isProcessed;
+        for (const auto& meta : entry.metadata) item->metadata.insert(meta);
+        item->metadata["Incremental"] = "Unchanged, reused from manifest";
+        ++reused;
+        return item;
+    }
+
+    /**
+     * Record Method
+     * -------------
+     * Stores the result of a processed file:// source with the file state captured before it was loaded
+     * (CaptureFileState) and the current run context. A result with a "Pipeline Stopped" entry
+     * (cancellation, deadline, pass limit) is not a finished result: it is not stored, and any earlier
+     * entry for the source is dropped, so the next run processes the source again.
+     *
+     * Parameters:
+     * - source (const std::string&): The input source.
+     * - state (const FileState&): The file's state taken before loading it.
+     * - item (const ActionResult&): The finished result.
+     *
+     * Returns:
+     * - bool: true if the result was stored, false if it was stopped early.
+     */
+    bool Record(const std::string& source, const FileState& state, const ActionResult& item) {
+        if (item.metadata.count("Pipeline Stopped") > 0) {
+            entries.erase(source);
+            return false;
+        }
+        Entry entry;
+        entry.context = context;
+        entry.fingerprint = state.fingerprint;
+        entry.hash = state.hash;
+        entry.finalSource = item.source;
+        entry.type = item.type;
+        entry.content = item.content.str();
+        entry.isProcessed = item.isProcessed;
+        entry.metadata.assign(item.metadata.begin(), item.metadata.end());
+        entries[source] = std::move(entry);
+        ++recorded;
+        return true;
+    }
+
+    std::size_t ReusedCount() const { return reused; }
+    std::size_t RecordedCount() const { return recorded; }
+
+private:
+    struct Entry {
+        std::uint64_t context = 0;
+        FileFingerprint fingerprint;
+        std::uint64_t hash = 0;
+        std::string finalSource;
+        DataType type = DataType::UNKNOWN;
+        std::string content;
+        bool isProcessed = false;
+        std::vector<std::pair<std::string, std::string>> metadata;
+    };
+
+    static const char* Header() { return "ComputePipeline manifest 2"; }
+
+    static std::string Escape(const std::string& field) {
+        std::string escaped;
+        escaped.reserve(field.size());
+        for (char c : field) {
+            if (c == '\\') escaped += "\\\\";
+            else if (c == '\t') escaped += "\\t";
+            else if (c == '\n') escaped += "\\n";
+            else escaped += c;
+        }
+        return escaped;
+    }
+
+    // Splits a line on tabs and unescapes each field.
+    static std::vector<std::string> SplitFields(const std::string& line) {
+        std::vector<std::string> fields(1);
+        for (std::size_t i = 0; i < line.size(); ++i) {
+            char c = line[i];
+            if (c == '\t') {
+                fields.emplace_back();
+            }
+            else if (c == '\\' && i + 1 < line.size()) {
+                char next = line[++i];
+                fields.back() += (next == 't') ? '\t' : (next == 'n') ? '\n' : next;
+            }
+            else {
+                fields.back() += c;
+            }
+        }
+        return fields;
+    }
+
+    // True if `text` from `first` on is a non-empty run of digits in `base` (10 or 16).
+    static bool AllDigits(const std::string& text, std::size_t first, int base) {
+        if (text.size() <= first) return false;
+        for (std::size_t i = first; i < text.size(); ++i) {
+            unsigned char c = static_cast<unsigned char>(text[i]);
+            if (!(base == 16 ? std::isxdigit(c) : std::isdigit(c))) return false;
+        }
+        return true;
+    }
+
+    // Parses a whole field as an unsigned number in `base`. Signs, blanks, "0x" prefixes, trailing
+    // characters and values that do not fit are rejected (strtoull alone would skip blanks, negate
+    // "-1" and saturate).
+    static bool ParseUnsigned(const std::string& field, int base, std::uint64_t& value) {
+        if (!AllDigits(field, 0, base)) return false;
+        char* end = nullptr;
+        errno = 0;
+        unsigned long long parsed = std::strtoull(field.c_str(), &end, base);
+        if (errno != 0 || end != field.c_str() + field.size()) return false;
+        value = parsed;
+        return true;
+    }
+
+    // Parses a whole field as a signed decimal number, with the same checks as ParseUnsigned.
+    static bool ParseSigned(const std::string& field, std::int64_t& value) {
+        if (!AllDigits(field, (!field.empty() && field[0] == '-') ? 1 : 0, 10)) return false;
+        char* end = nullptr;
+        errno = 0;
+        long long parsed = std::strtoll(field.c_str(), &end, 10);
+        if (errno != 0 || end != field.c_str() + field.size()) return false;
+        value = parsed;
+        return true;
+    }
+
+    // Parses one entry line. Every numeric and flag field must be consumed completely, so a damaged
+    // line is rejected instead of being restored with partly parsed values.
+    static bool ParseLine(const std::string& line, std::string& source, Entry& entry) {
+        std::vector<std::string> fields = SplitFields(line);
+        if (fields.size() < 10) return false;
+
+        source = fields[0];
+        if (!ParseUnsigned(fields[1], 16, entry.context) || !ParseUnsigned(fields[2], 10, entry.fingerprint.size) ||
+            !ParseSigned(fields[3], entry.fingerprint.mtimeNs) || !ParseUnsigned(fields[4], 16, entry.hash)) {
+            return false;
+        }
+        entry.finalSource = fields[5];
+        if (!ParseDataType(fields[6], entry.type)) return false;
+        entry.content = fields[7];
+        if (fields[8] != "0" && fields[8] != "1") return false;
+        entry.isProcessed = fields[8] == "1";
+
+        std::uint64_t metaCount = 0;
+        if (!ParseUnsigned(fields[9], 10, metaCount)) return false;
+        if (metaCount > fields.size() || fields.size() != 10 + 2 * metaCount) return false;
+        for (std::size_t i = 0; i < metaCount; ++i) {
+            entry.metadata.emplace_back(fields[10 + 2 * i], fields[11 + 2 * i]);
+        }
+        return true;
+    }
+
+    static void WriteLine(std::ostream& out, const std::string& source, const Entry& entry) {
+        std::ostringstream context, hash;
+        context << std::hex << entry.context;
+        hash << std::hex << entry.hash;
+        out << Escape(source) << '\t' << context.str() << '\t' << entry.fingerprint.size << '\t' << entry.fingerprint.mtimeNs << '\t'
+            << hash.str() << '\t' << Escape(entry.finalSource) << '\t' << DataTypeName(entry.type) << '\t'
+            << Escape(entry.content) << '\t' << (entry.isProcessed ? 1 : 0) << '\t' << entry.metadata.size();
+        for (const auto& meta : entry.metadata) {
+            out << '\t' << Escape(meta.first) << '\t' << Escape(meta.second);
+        }
+        out << '\n';
+    }
+
+    std::unordered_map<std::string, Entry> entries; // Input source -> recorded state.
+    std::uint64_t context;                          // Hash of the stage graph and seed of this run.
+    std::size_t reused;                             // Sources restored by Reuse in this run.
+    std::size_t recorded;                           // Sources recorded by Record in this run.
+};
+
+#endif
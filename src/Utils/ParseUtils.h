@@ -0,0 +1,86 @@
+#ifndef PARSE_UTILS_H
+#define PARSE_UTILS_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * ParseUtils Utility
+ * ------------------
+ * Strict parsers for the counts and byte sizes found in config files, command lines and metadata.
+ * Values are digits only and bounded by the caller, so signs, blanks, trailing text and overflow are
+ * rejected instead of wrapping around or saturating (as strtoull would).
+ */
+
+/**
+ * Trim Function
+ * -------------
+ * Returns `text` without leading and trailing spaces, tabs and line breaks.
+ */
+inline std::string Trim(const std::string& text) {
+    const char* whitespace = " \t\r\n";
+    std::string::size_type begin = text.find_first_not_of(whitespace);
+    if (begin == std::string::npos) return std::string();
+    std::string::size_type end = text.find_last_not_of(whitespace);
+    return text.substr(begin, end - begin + 1);
+}
+
+/**
+ * ParseCount Function
+ * -------------------
+ * Parses a decimal count in [0 or 1, maxValue].
+ *
+ * Parameters:
+ * - value (const std::string&): Decimal digits only.
+ * - out (std::size_t&): Receives the count; unchanged on failure.
+ * - maxValue (std::size_t): Largest accepted count.
+ * - allowZero (bool): Whether 0 is accepted.
+ *
+ * Returns:
+ * - bool: false if `value` is not a number or lies outside the range.
+ */
+inline bool ParseCount(const std::string& value, std::size_t& out, std::size_t maxValue, bool allowZero = false) {
+    if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos) return false;
+    std::size_t parsed = 0;
+    for (char digit : value) {
+        std::size_t digitValue = static_cast<std::size_t>(digit - '0');
+        if (digitValue > maxValue || parsed > (maxValue - digitValue) / 10) return false;
+        parsed = parsed * 10 + digitValue;
+    }
+    if (parsed == 0 && !allowZero) return false;
+    out = parsed;
+    return true;
+}
+
+/**
+ * CountRange Function
+ * -------------------
+ * Describes the values accepted by ParseCount, for error messages.
+ */
+inline std::string CountRange(std::size_t maxValue, bool allowZero = false) {
+    return std::string("an integer from ") + (allowZero ? "0" : "1") + " to " + std::to_string(maxValue);
+}
+
+/**
+ * ParseByteSize Function
+ * ----------------------
+ * Parses a byte size with an optional K, M or G suffix (powers of 1024). 0 is allowed; sizes that
+ * do not fit in std::size_t are rejected.
+ */
+inline bool ParseByteSize(const std::string& value, std::size_t& out) {
+    std::string digits = value;
+    std::size_t scale = 1;
+    if (!digits.empty()) {
+        char suffix = digits.back();
+        if (suffix == 'K' || suffix == 'k') scale = std::size_t(1) << 10;
+        else if (suffix == 'M' || suffix == 'm') scale = std::size_t(1) << 20;
+        else if (suffix == 'G' || suffix == 'g') scale = std::size_t(1) << 30;
+        if (scale != 1) digits = Trim(digits.substr(0, digits.size() - 1));
+    }
+    std::size_t count = 0;
+    if (!ParseCount(digits, count, static_cast<std::size_t>(-1) / scale, true)) return false;
+    out = count * scale;
+    return true;
+}
+
+#endif
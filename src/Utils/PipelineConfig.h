@@ -0,0 +1,438 @@
+#ifndef PIPELINE_CONFIG_H
+#define PIPELINE_CONFIG_H
+
+#include "../Core/ActionResult.h"  // DataType and its name helpers.
+#include "../Core/IProcessor.h"    // Interface for processing systems.
+#include "../Utils/ParseUtils.h"   // Count, byte size and whitespace parsing.
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * PipelineConfig Utility
+ * ----------------------
+ * Describes the processing pipeline as a graph of stages, loaded from a configuration file at startup.
+ *
+ * File Format:
+ *   # Comment lines start with '#'.
+ *   [loader]
+ *   threads = 2             # Loader worker threads.
+ *   queue_depth = 64        # Capacity of the loader input queue.
+ *   http_latency_ms = 0     # Simulated round trip of the HTTP stub (0 = none).
+ *
+ *   [memory]
+ *   limit = 256M            # Payload byte budget (K/M/G suffixes, 0 = unlimited). A single payload
+ *                           # larger than the limit is still admitted when no other payload is
+ *                           # held, so it runs alone instead of blocking forever.
+ *
+ *   [affinity]
+ *   pin_threads = false     # Pin loader and stage workers to CPUs, spread over NUMA nodes.
+ *
+ *   [limits]
+ *   item_timeout_ms = 0     # Per-item deadline from the start of its load (0 = none).
+ *   batch_timeout_ms = 0    # Deadline for a whole batch (0 = none).
+ *
+ *   [stage decompress]      # One section per stage; the name must be unique.
+ *   processor = DecompressSystem
+ *   accepts = COMPRESSED    # DataTypes routed to this stage (comma separated).
+ *   emits = IMAGE, JSON, COMPRESSED
+ *   threads = 1             # Worker threads (stage replicas).
+ *   queue_depth = 64        # Capacity of the stage input queue.
+ *   batch_size = 8          # Items taken from the queue per wake-up.
+ *
+ * Validation Rules:
+ * - At least one stage, unique stage names, a processor and at least one accepted type per stage.
+ * - Each DataType is accepted by at most one stage (dispatch must be unambiguous).
+ * - Every emitted DataType is accepted by some stage.
+ * - The stage graph has no cycles, except a stage emitting its own accepted type (e.g., nested archives).
+ * - threads is at most 1024; queue_depth and batch_size are at most 1048576; all three are positive.
+ * - Millisecond values (http_latency_ms, item_timeout_ms, batch_timeout_ms) are at most 86400000 (one day).
+ */
+
+/**
+ * Largest accepted values for counts in a configuration file. Larger values are rejected at parse
+ * time instead of wrapping around or starting millions of threads.
+ */
+constexpr std::size_t kMaxConfigThreads = 1024;
+constexpr std::size_t kMaxConfigQueueDepth = std::size_t(1) << 20;
+constexpr std::size_t kMaxConfigMilliseconds = 24 * 60 * 60 * 1000;
+
+/**
+ * StageConfig Struct
+ * ------------------
+ * Configuration of a single pipeline stage.
+ */
+struct StageConfig {
+    std::string name;             // Unique stage name.
+    std::string processor;        // Registered processor name (e.g., "DecodeImageSystem").
+    std::vector<DataType> accepts; // Types routed to this stage.
+    std::vector<DataType> emits;   // Types this stage may hand to other stages.
+    std::size_t threads = 1;      // Number of worker threads (stage replicas).
+    std::size_t queueDepth = 64;  // Capacity of the stage input queue.
+    std::size_t batchSize = 1;    // Items taken per wake-up.
+};
+
+/**
+ * PipelineConfig Struct
+ * ---------------------
+ * Full pipeline configuration: loader settings plus the list of stages.
+ */
+struct PipelineConfig {
+    std::size_t loaderThreads = 1;     // Number of loader worker threads.
+    std::size_t loaderQueueDepth = 64; // Capacity of the loader input queue.
+    std::size_t httpLatencyMs = 0;     // Simulated HTTP round trip in milliseconds (0 = none).
+    std::size_t memoryLimitBytes = 0;  // Payload byte budget (0 = unlimited).
+    bool pinThreads = false;           // Pin workers to CPUs and keep items on their NUMA node.
+    std::size_t itemTimeoutMs = 0;     // Per-item deadline in milliseconds (0 = none).
+    std::size_t batchTimeoutMs = 0;    // Batch deadline in milliseconds (0 = none).
+    std::vector<StageConfig> stages;   // Stage definitions, in file order.
+
+    /**
+     * Default Method (Static)
+     * -----------------------
+     * Returns the built-in configuration, equivalent to the original hardcoded pipeline
+     * (one processor per DataType, a single thread per stage).
+     */
+    static PipelineConfig Default() {
+        PipelineConfig config;
+        config.stages.push_back(MakeStage("decompress", "DecompressSystem", { DataType::COMPRESSED },
+                                          { DataType::IMAGE, DataType::JSON, DataType::COMPRESSED }));
+        config.stages.push_back(MakeStage("decode_image", "DecodeImageSystem", { DataType::IMAGE }, {}));
+        config.stages.push_back(MakeStage("parse_json", "ParseJsonSystem", { DataType::JSON }, {}));
+        config.stages.push_back(MakeStage("unknown", "UnknownFileSystem", { DataType::UNKNOWN }, {}));
+        return config;
+    }
+
+private:
+    static StageConfig MakeStage(const char* name, const char* processor,
+                                 std::vector<DataType> accepts, std::vector<DataType> emits) {
+        StageConfig stage;
+        stage.name = name;
+        stage.processor = processor;
+        stage.accepts = std::move(accepts);
+        stage.emits = std::move(emits);
+        return stage;
+    }
+};
+
+/**
+ * CompiledStage Struct
+ * --------------------
+ * A validated stage with its processor name resolved to a factory function.
+ */
+struct CompiledStage {
+    StageConfig config;                                      // Validated stage configuration.
+    std::function<std::unique_ptr<IProcessor>()> createProcessor; // Creates one processor per replica.
+
+    /**
+     * Returns true if the stage declares `type` in its emits list.
+     */
+    bool Emits(DataType type) const {
+        return std::find(config.emits.begin(), config.emits.end(), type) != config.emits.end();
+    }
+};
+
+/**
+ * CompiledPipeline Struct
+ * -----------------------
+ * Flat dispatch form of a PipelineConfig: `dispatch[type]` is the index of the stage that accepts
+ * the type, or -1 when no stage does.
+ */
+struct CompiledPipeline {
+    std::size_t loaderThreads = 1;
+    std::size_t loaderQueueDepth = 64;
+    std::size_t httpLatencyMs = 0;
+    std::size_t memoryLimitBytes = 0;
+    bool pinThreads = false;
+    std::size_t itemTimeoutMs = 0;
+    std::size_t batchTimeoutMs = 0;
+    std::vector<CompiledStage> stages;
+    std::array<int, kDataTypeCount> dispatch;
+
+    CompiledPipeline() { dispatch.fill(-1); }
+
+    /**
+     * Returns the stage index for the given type, or -1 if no stage accepts it.
+     */
+    int StageFor(DataType type) const { return dispatch[static_cast<std::size_t>(type)]; }
+};
+
+namespace PipelineConfigDetail {
+
+inline bool ParseFlag(const std::string& value, bool& out) {
+    if (value == "true" || value == "on" || value == "1") out = true;
+    else if (value == "false" || value == "off" || value == "0") out = false;
+    else return false;
+    return true;
+}
+
+inline bool ParseTypeList(const std::string& value, std::vector<DataType>& out) {
+    std::stringstream stream(value);
+    std::string token;
+    while (std::getline(stream, token, ',')) {
+        token = Trim(token);
+        if (token.empty()) continue;
+        DataType type;
+        if (!ParseDataType(token, type)) return false;
+        out.push_back(type);
+    }
+    return true;
+}
+
+// Depth-first search for cycles between distinct stages (self-loops are allowed).
+inline bool HasCycle(std::size_t stage, const std::vector<std::vector<std::size_t>>& edges,
+                     std::vector<int>& state) {
+    state[stage] = 1; // Visiting.
+    for (std::size_t next : edges[stage]) {
+        if (next == stage) continue;
+        if (state[next] == 1) return true;
+        if (state[next] == 0 && HasCycle(next, edges, state)) return true;
+    }
+    state[stage] = 2; // Done.
+    return false;
+}
+
+} // namespace PipelineConfigDetail
+
+/**
+ * ParsePipelineConfig Function
+ * ----------------------------
+ * Parses a pipeline configuration from a stream. Parsing does not validate the stage graph;
+ * call ValidatePipelineConfig afterwards (LoadPipelineConfig does both).
+ *
+ * Parameters:
+ * - in (std::istream&): The configuration text.
+ * - config (PipelineConfig&): Receives the parsed configuration.
+ * - errors (std::vector<std::string>&): Receives one message per problem found.
+ *
+ * Returns:
+ * - bool: true if no errors were found.
+ */
+inline bool ParsePipelineConfig(std::istream& in, PipelineConfig& config, std::vector<std::string>& errors) {
+    using namespace PipelineConfigDetail;
+
+    config = PipelineConfig();
+    enum class Section { NONE, LOADER, MEMORY, AFFINITY, LIMITS, STAGE } section = Section::NONE;
+    std::string line;
+    std::size_t lineNumber = 0;
+    std::size_t errorCount = errors.size();
+
+    while (std::getline(in, line)) {
+        ++lineNumber;
+        std::string where = "line " + std::to_string(lineNumber) + ": ";
+        std::string::size_type comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+        line = Trim(line);
+        if (line.empty()) continue;
+
+        // Section headers: [loader] or [stage NAME].
+        if (line.front() == '[') {
+            if (line.back() != ']') {
+                errors.push_back(where + "unterminated section header");
+                continue;
+            }
+            std::string header = Trim(line.substr(1, line.size() - 2));
+            if (header == "loader") {
+                section = Section::LOADER;
+            }
+            else if (header == "memory") {
+                section = Section::MEMORY;
+            }
+            else if (header == "affinity") {
+                section = Section::AFFINITY;
+            }
+            else if (header == "limits") {
+                section = Section::LIMITS;
+            }
+            else if (header.compare(0, 6, "stage ") == 0 && !Trim(header.substr(6)).empty()) {
+                section = Section::STAGE;
+                config.stages.push_back(StageConfig());
+                config.stages.back().name = Trim(header.substr(6));
+            }
+            else {
+                errors.push_back(where + "unknown section [" + header + "]");
+                section = Section::NONE;
+            }
+            continue;
+        }
+
+        // Key/value pairs.
+        std::string::size_type equals = line.find('=');
+        if (equals == std::string::npos) {
+            errors.push_back(where + "expected 'key = value'");
+            continue;
+        }
+        std::string key = Trim(line.substr(0, equals));
+        std::string value = Trim(line.substr(equals + 1));
+
+        if (section == Section::LOADER) {
+            bool ok = false;
+            std::string range;
+            if (key == "threads") {
+                ok = ParseCount(value, config.loaderThreads, kMaxConfigThreads);
+                range = CountRange(kMaxConfigThreads);
+            }
+            else if (key == "queue_depth") {
+                ok = ParseCount(value, config.loaderQueueDepth, kMaxConfigQueueDepth);
+                range = CountRange(kMaxConfigQueueDepth);
+            }
+            else if (key == "http_latency_ms") {
+                ok = ParseCount(value, config.httpLatencyMs, kMaxConfigMilliseconds, true);
+                range = CountRange(kMaxConfigMilliseconds, true);
+            }
+            else { errors.push_back(where + "unknown loader key '" + key + "'"); continue; }
+            if (!ok) errors.push_back(where + "'" + key + "' must be " + range);
+        }
+        else if (section == Section::MEMORY) {
+            if (key != "limit") { errors.push_back(where + "unknown memory key '" + key + "'"); continue; }
+            if (!ParseByteSize(value, config.memoryLimitBytes)) {
+                errors.push_back(where + "'limit' must be a byte size such as 1048576, 512K, 256M or 1G");
+            }
+        }
+        else if (section == Section::AFFINITY) {
+            if (key != "pin_threads") { errors.push_back(where + "unknown affinity key '" + key + "'"); continue; }
+            if (!ParseFlag(value, config.pinThreads)) errors.push_back(where + "'pin_threads' must be true or false");
+        }
+        else if (section == Section::LIMITS) {
+            bool ok = false;
+            if (key == "item_timeout_ms") ok = ParseCount(value, config.itemTimeoutMs, kMaxConfigMilliseconds, true);
+            else if (key == "batch_timeout_ms") ok = ParseCount(value, config.batchTimeoutMs, kMaxConfigMilliseconds, true);
+            else { errors.push_back(where + "unknown limits key '" + key + "'"); continue; }
+            if (!ok) errors.push_back(where + "'" + key + "' must be " + CountRange(kMaxConfigMilliseconds, true));
+        }
+        else if (section == Section::STAGE) {
+            StageConfig& stage = config.stages.back();
+            if (key == "processor") {
+                stage.processor = value;
+            }
+            else if (key == "accepts" || key == "emits") {
+                std::vector<DataType>& types = (key == "accepts") ? stage.accepts : stage.emits;
+                if (!ParseTypeList(value, types)) errors.push_back(where + "unknown data type in '" + value + "'");
+            }
+            else if (key == "threads" || key == "queue_depth" || key == "batch_size") {
+                std::size_t& target = (key == "threads") ? stage.threads
+                                    : (key == "queue_depth") ? stage.queueDepth : stage.batchSize;
+                std::size_t maxValue = (key == "threads") ? kMaxConfigThreads : kMaxConfigQueueDepth;
+                if (!ParseCount(value, target, maxValue)) errors.push_back(where + "'" + key + "' must be " + CountRange(maxValue));
+            }
+            else {
+                errors.push_back(where + "unknown stage key '" + key + "'");
+            }
+        }
+        else {
+            errors.push_back(where + "key '" + key + "' outside of a section");
+        }
+    }
+
+    return errors.size() == errorCount;
+}
+
+/**
+ * ValidatePipelineConfig Function
+ * -------------------------------
+ * Checks the stage graph of a parsed configuration (see Validation Rules above).
+ *
+ * Returns:
+ * - bool: true if the configuration is valid; otherwise messages are appended to `errors`.
+ */
+inline bool ValidatePipelineConfig(const PipelineConfig& config, std::vector<std::string>& errors) {
+    std::size_t errorCount = errors.size();
+    const std::vector<StageConfig>& stages = config.stages;
+
+    if (stages.empty()) errors.push_back("pipeline has no stages");
+
+    std::array<int, kDataTypeCount> owner;
+    owner.fill(-1);
+    for (std::size_t i = 0; i < stages.size(); ++i) {
+        const StageConfig& stage = stages[i];
+        for (std::size_t j = 0; j < i; ++j) {
+            if (stages[j].name == stage.name) errors.push_back("duplicate stage name '" + stage.name + "'");
+        }
+        if (stage.processor.empty()) errors.push_back("stage '" + stage.name + "' has no processor");
+        if (stage.accepts.empty()) errors.push_back("stage '" + stage.name + "' accepts no data types");
+        for (DataType type : stage.accepts) {
+            int& current = owner[static_cast<std::size_t>(type)];
+            if (current >= 0 && current != static_cast<int>(i)) {
+                errors.push_back(std::string("data type ") + DataTypeName(type) + " is accepted by both '" +
+                                 stages[current].name + "' and '" + stage.name + "'");
+            }
+            current = static_cast<int>(i);
+        }
+    }
+
+    // Build stage-to-stage edges from emitted types.
+    std::vector<std::vector<std::size_t>> edges(stages.size());
+    for (std::size_t i = 0; i < stages.size(); ++i) {
+        for (DataType type : stages[i].emits) {
+            int target = owner[static_cast<std::size_t>(type)];
+            if (target < 0) {
+                errors.push_back("stage '" + stages[i].name + "' emits " + DataTypeName(type) +
+                                 " but no stage accepts it");
+                continue;
+            }
+            edges[i].push_back(static_cast<std::size_t>(target));
+        }
+    }
+
+    std::vector<int> state(stages.size(), 0);
+    for (std::size_t i = 0; i < stages.size(); ++i) {
+        if (state[i] == 0 && PipelineConfigDetail::HasCycle(i, edges, state)) {
+            errors.push_back("stage graph has a cycle through '" + stages[i].name + "'");
+            break;
+        }
+    }
+
+    return errors.size() == errorCount;
+}
+
+/**
+ * DescribeStageGraph Function
+ * ---------------------------
+ * Returns a canonical text form of the parts of a configuration that decide an item's result: each
+ * stage's name, processor and accepted and emitted types. Tuning settings (threads, queue depths,
+ * batch sizes, memory limit, pinning, timeouts) are left out; they change how fast items finish,
+ * not what a finished item contains. Used to key incremental results (IncrementalManifest).
+ */
+inline std::string DescribeStageGraph(const PipelineConfig& config) {
+    std::string text;
+    for (const StageConfig& stage : config.stages) {
+        text += "[stage " + stage.name + "] processor=" + stage.processor + " accepts=";
+        for (DataType type : stage.accepts) text += std::string(DataTypeName(type)) + ",";
+        text += " emits=";
+        for (DataType type : stage.emits) text += std::string(DataTypeName(type)) + ",";
+        text += "\n";
+    }
+    return text;
+}
+
+/**
+ * LoadPipelineConfig Function
+ * ---------------------------
+ * Reads, parses and validates a pipeline configuration file.
+ *
+ * Parameters:
+ * - path (const std::string&): Path to the configuration file.
+ * - config (PipelineConfig&): Receives the configuration.
+ * - errors (std::vector<std::string>&): Receives one message per problem found.
+ *
+ * Returns:
+ * - bool: true if the file was loaded and is valid.
+ */
+inline bool LoadPipelineConfig(const std::string& path, PipelineConfig& config, std::vector<std::string>& errors) {
+    std::ifstream file(path);
+    if (!file) {
+        errors.push_back("cannot open pipeline config: " + path);
+        return false;
+    }
+    if (!ParsePipelineConfig(file, config, errors)) return false;
+    return ValidatePipelineConfig(config, errors);
+}
+
+#endif
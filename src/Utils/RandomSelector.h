@@ -1,52 +1,144 @@
 #ifndef RANDOM_SELECTOR_H
 #define RANDOM_SELECTOR_H
 
-#include <vector>
+#include "../Utils/Hash.h"  // FNV-1a for item keys.
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <string>
-#include <cstdlib>  // For std::rand() and std::srand()
-#include <ctime>    // For std::time()
+#include <vector>
 
 /**
  * RandomSelector Utility
  * ----------------------
- * Utility for selecting a random file extension.
- * This utility is used to simulate the decompression of files by randomly assigning new extensions.
+ * Deterministic pseudo-random numbers for the simulation, and the random file extension used to
+ * simulate the decompression of files.
  *
  * Responsibilities:
- * - Randomly selects an extension from a predefined list.
- * - Initializes the random seed only once to ensure randomness across executions.
- * - Returns the selected extension as a string.
- */
-
- /**
-  * GetRandomExtension Function
-  * ---------------------------
-  * Selects a random extension from a predefined list of possible extensions.
-  * This function is used in the DecompressSystem to simulate the output of decompressed files.
-  *
-  * Workflow:
-  * - Initializes the random seed only once to ensure randomness.
-  * - Chooses a random extension from the list:
-  *     - .jpg  -> Simulates an image output.
-  *     - .json -> Simulates a JSON output.
-  *     - .zip  -> Simulates a nested compressed file.
-  *
-  * Returns:
-  * - std::string: The randomly selected extension.
-  */
-inline std::string GetRandomExtension() {
-    // Initialize the seed only once, on the first call.
-    static bool seedInitialized = false;
-    if (!seedInitialized) {
-        srand(static_cast<unsigned int>(time(nullptr)));  // Seed for randomness.
-        seedInitialized = true;                           // Mark as initialized.
+ * - Provides a small seeded generator (RandomGenerator) that yields the same sequence on every
+ *   platform and standard library, so recorded runs can be replayed across builds.
+ * - Derives every random choice made for an item from the run seed and a key naming the item,
+ *   using a generator local to that choice, so results do not depend on which thread processed
+ *   the item or in which order, and workers never share generator state.
+ */
+
+/**
+ * Seed used when none is given (ComputePipeline --seed, or a "# seed:" line in an inputs file).
+ */
+constexpr std::uint64_t kDefaultRandomSeed = 1;
+
+/**
+ * ParseSeed Function
+ * ------------------
+ * Parses a seed written as decimal digits only (no sign, spaces or trailing text).
+ *
+ * Returns:
+ * - bool: false (leaving `out` unchanged) if `text` is not a number or does not fit in 64 bits.
+ */
+inline bool ParseSeed(const std::string& text, std::uint64_t& out) {
+    if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) return false;
+    std::uint64_t parsed = 0;
+    for (char digit : text) {
+        std::uint64_t digitValue = static_cast<std::uint64_t>(digit - '0');
+        if (parsed > (UINT64_MAX - digitValue) / 10) return false;
+        parsed = parsed * 10 + digitValue;
     }
+    out = parsed;
+    return true;
+}
+
+/**
+ * RandomGenerator Class
+ * ---------------------
+ * SplitMix64 generator: 64 bits of state, fast, and fully specified (unlike the std:: distributions).
+ */
+class RandomGenerator {
+public:
+    explicit RandomGenerator(std::uint64_t seed = kDefaultRandomSeed) : state(seed) {
+    }
+
+    void Seed(std::uint64_t seed) { state = seed; }
+
+    /**
+     * Returns the next 64-bit value.
+     */
+    std::uint64_t Next() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * Returns a value in [0, bound), or 0 when bound is 0.
+     */
+    std::uint64_t NextBelow(std::uint64_t bound) { return bound > 0 ? Next() % bound : 0; }
+
+    /**
+     * Returns a value in [0, 1).
+     */
+    double NextDouble() { return static_cast<double>(Next() >> 11) * (1.0 / 9007199254740992.0); }
+
+private:
+    std::uint64_t state;
+};
 
+/**
+ * Combines a seed with a second value (e.g., a thread index or a key hash) into a new seed.
+ */
+inline std::uint64_t MixSeed(std::uint64_t seed, std::uint64_t value) {
+    RandomGenerator mixer(seed ^ (value * 0xD6E8FEB86659FD93ull));
+    return mixer.Next();
+}
+
+/**
+ * Returns the 64-bit FNV-1a hash of a key.
+ */
+inline std::uint64_t HashKey(const std::string& key) {
+    return Fnv1a(key);
+}
+
+inline std::atomic<std::uint64_t>& RandomSeedStorage() {
+    static std::atomic<std::uint64_t> seed(kDefaultRandomSeed);
+    return seed;
+}
+
+/**
+ * SetRandomSeed Function
+ * ----------------------
+ * Sets the run seed. Call it before starting any worker, so every choice of a run uses the same seed.
+ */
+inline void SetRandomSeed(std::uint64_t seed) { RandomSeedStorage().store(seed); }
+
+inline std::uint64_t GetRandomSeed() { return RandomSeedStorage().load(); }
+
+/**
+ * GetRandomExtension Function
+ * ---------------------------
+ * Selects a random extension from a predefined list of possible extensions.
+ * This function is used in the DecompressSystem to simulate the output of decompressed files.
+ *
+ * Workflow:
+ * - Seeds a local generator from the run seed, `key` and `salt`, so the same inputs always yield
+ *   the same extension for a given seed.
+ * - Chooses a random extension from the list:
+ *     - .jpg  -> Simulates an image output.
+ *     - .json -> Simulates a JSON output.
+ *     - .zip  -> Simulates a nested compressed file.
+ *
+ * Parameters:
+ * - key (const std::string&): Identifies the choice (e.g., the item's source).
+ * - salt (std::uint64_t): Distinguishes repeated choices for the same key (e.g., the nesting depth).
+ *
+ * Returns:
+ * - const std::string&: The randomly selected extension (refers to a static entry, no copy).
+ */
+inline const std::string& GetRandomExtension(const std::string& key, std::uint64_t salt = 0) {
     // Possible extensions for decompressed files (constant and reusable).
     static const std::vector<std::string> extensions = { ".jpg", ".json", ".zip" };
 
-    // Randomly select an extension.
-    return extensions[std::rand() % extensions.size()];
+    RandomGenerator generator(MixSeed(MixSeed(GetRandomSeed(), HashKey(key)), salt));
+    return extensions[static_cast<std::size_t>(generator.NextBelow(extensions.size()))];
 }
 
 #endif
@@ -0,0 +1,193 @@
+#ifndef SCHEME_DETECTOR_H
+#define SCHEME_DETECTOR_H
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <emmintrin.h>
+#define SCHEME_DETECTOR_USE_SSE2 1
+#endif
+
+/**
+ * SourceScheme Enum
+ * -----------------
+ * Enumerates the source protocols understood by the LoaderFactory.
+ *
+ * Values:
+ * - FILE    -> file://
+ * - HTTP    -> http://
+ * - HTTPS   -> https://
+ * - BUNDLE  -> bundle://
+ * - UNKNOWN -> Any other (unsupported) protocol.
+ */
+enum class SourceScheme {
+    FILE,
+    HTTP,
+    HTTPS,
+    BUNDLE,
+    UNKNOWN
+};
+
+/**
+ * SchemeDetector Utility
+ * ----------------------
+ * Detects the protocol prefix of a source.
+ * The first 16 bytes of the source are compared against every known prefix with a single SSE2 byte
+ * compare each (scalar memcmp fallback), so classifying large input lists is a straight pass over
+ * the data instead of a chain of string searches. The batch form (DetectSchemes) keeps the pattern
+ * blocks in registers for the whole batch and loads long sources directly from their buffers.
+ */
+
+namespace SchemeDetectorDetail {
+
+constexpr std::size_t kPrefixBytes = 16;
+constexpr std::size_t kPatternCount = 4;
+
+struct SchemePattern {
+    const char* prefix;  // Protocol prefix, including "://".
+    unsigned length;     // Prefix length in bytes (at most kPrefixBytes).
+    SourceScheme scheme; // Scheme reported on a match.
+};
+
+// Known prefixes, in match priority order.
+inline const SchemePattern* Patterns() {
+    static const SchemePattern patterns[] = {
+        { "file://",   7, SourceScheme::FILE },
+        { "http://",   7, SourceScheme::HTTP },
+        { "https://",  8, SourceScheme::HTTPS },
+        { "bundle://", 9, SourceScheme::BUNDLE },
+    };
+    static_assert(sizeof(patterns) / sizeof(patterns[0]) == kPatternCount, "kPatternCount must match the pattern table");
+    return patterns;
+}
+
+// Copies the first kPrefixBytes of the source into a zero-padded block.
+inline void PackPrefix(const char* data, std::size_t size, char (&block)[kPrefixBytes]) {
+    std::memset(block, 0, kPrefixBytes);
+    std::memcpy(block, data, size < kPrefixBytes ? size : kPrefixBytes);
+}
+
+#ifdef SCHEME_DETECTOR_USE_SSE2
+// Zero-padded pattern blocks and the compare mask each one needs, built once.
+struct PatternBlocks {
+    __m128i blocks[kPatternCount];
+    unsigned needed[kPatternCount];
+
+    PatternBlocks() {
+        const SchemePattern* patterns = Patterns();
+        for (std::size_t i = 0; i < kPatternCount; ++i) {
+            char bytes[kPrefixBytes];
+            PackPrefix(patterns[i].prefix, patterns[i].length, bytes);
+            blocks[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+            needed[i] = (1u << patterns[i].length) - 1u;
+        }
+    }
+};
+static_assert(kPatternCount <= 8 * sizeof(unsigned), "pattern hits must fit in one mask word");
+
+inline const PatternBlocks& Blocks() {
+    static const PatternBlocks blocks;
+    return blocks;
+}
+
+// Loads the first 16 bytes of a source: straight from its buffer when it is long enough,
+// through a zero-padded copy otherwise.
+inline __m128i LoadPrefix(const std::string& source) {
+    if (source.size() >= kPrefixBytes) return _mm_loadu_si128(reinterpret_cast<const __m128i*>(source.data()));
+    char block[kPrefixBytes];
+    PackPrefix(source.data(), source.size(), block);
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+}
+
+// Compares a prefix block against every pattern without branching and returns the first match.
+inline SourceScheme MatchPrefix(__m128i prefix, const __m128i (&blocks)[kPatternCount],
+                                const unsigned (&needed)[kPatternCount]) {
+    unsigned hits = 0;
+    for (std::size_t i = 0; i < kPatternCount; ++i) {
+        unsigned equal = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(prefix, blocks[i])));
+        hits |= static_cast<unsigned>((equal & needed[i]) == needed[i]) << i;
+    }
+    return hits != 0 ? Patterns()[__builtin_ctz(hits)].scheme : SourceScheme::UNKNOWN;
+}
+#else
+inline SourceScheme MatchPrefix(const std::string& source) {
+    char block[kPrefixBytes];
+    PackPrefix(source.data(), source.size(), block);
+    const SchemePattern* patterns = Patterns();
+    for (std::size_t i = 0; i < kPatternCount; ++i) {
+        if (std::memcmp(block, patterns[i].prefix, patterns[i].length) == 0) return patterns[i].scheme;
+    }
+    return SourceScheme::UNKNOWN;
+}
+#endif
+
+} // namespace SchemeDetectorDetail
+
+ /**
+  * DetectScheme Function
+  * ---------------------
+  * Detects the protocol of a single source.
+  *
+  * Parameters:
+  * - source (const std::string&): The source string containing the file path or URL.
+  *
+  * Returns:
+  * - SourceScheme: The detected scheme, or UNKNOWN.
+  */
+inline SourceScheme DetectScheme(const std::string& source) {
+    using namespace SchemeDetectorDetail;
+#ifdef SCHEME_DETECTOR_USE_SSE2
+    const PatternBlocks& patterns = Blocks();
+    return MatchPrefix(LoadPrefix(source), patterns.blocks, patterns.needed);
+#else
+    return MatchPrefix(source);
+#endif
+}
+
+ /**
+  * DetectSchemes Function (Batch)
+  * ------------------------------
+  * Classifies a whole batch of sources in one pass. The pattern blocks are copied into locals once
+  * per batch (no per-item static initialization check, and the compiler keeps them in registers),
+  * and each source costs one 16-byte load and kPatternCount compares.
+  *
+  * Parameters:
+  * - sources (const std::string*): The first source of the batch.
+  * - count (std::size_t): The number of sources.
+  * - schemes (SourceScheme*): Output array with room for `count` entries.
+  */
+inline void DetectSchemes(const std::string* sources, std::size_t count, SourceScheme* schemes) {
+    using namespace SchemeDetectorDetail;
+#ifdef SCHEME_DETECTOR_USE_SSE2
+    const PatternBlocks& patterns = Blocks();
+    __m128i blocks[kPatternCount];
+    unsigned needed[kPatternCount];
+    for (std::size_t i = 0; i < kPatternCount; ++i) {
+        blocks[i] = patterns.blocks[i];
+        needed[i] = patterns.needed[i];
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        schemes[i] = MatchPrefix(LoadPrefix(sources[i]), blocks, needed);
+    }
+#else
+    for (std::size_t i = 0; i < count; ++i) {
+        schemes[i] = MatchPrefix(sources[i]);
+    }
+#endif
+}
+
+ /**
+  * DetectSchemes Function (Batch, Vector)
+  * --------------------------------------
+  * Convenience overload returning one SourceScheme per source, in input order.
+  */
+inline std::vector<SourceScheme> DetectSchemes(const std::vector<std::string>& sources) {
+    std::vector<SourceScheme> schemes(sources.size());
+    DetectSchemes(sources.data(), sources.size(), schemes.data());
+    return schemes;
+}
+
+#endif
@@ -1,12 +1,176 @@
 #include "Core/ActionResult.h"                      // Core structure for processing results.
 #include "Factories/PipelineManagerFactory.h"       // Factory for creating a fully configured PipelineManager.
 #include "Factories/LoaderFactory.h"                // Factory for selecting the appropriate Loader.
+#include "Utils/PipelineConfig.h"                   // Stage graph configuration loaded at startup.
+#include "Sinks/ResultColumnWriter.h"               // Columnar binary output for processed results.
+#include "Sinks/ResultColumnReader.h"               // Zero-copy reader for columnar result files.
+#include "Utils/IncrementalManifest.h"              // Change detection for incremental runs.
+#include "Utils/RandomSelector.h"                   // Run seed for deterministic simulation.
+#include <cstdint>
+#include <cstdlib>
 #include <vector>
 #include <memory>
+#include <fstream>
 #include <iostream>
+#include <string>
 
-int main() 
+/**
+ * Options Struct
+ * --------------
+ * Command line options:
+ *   ComputePipeline [config] [--inputs FILE] [--output FILE] [--read FILE]
+ *                   [--incremental MANIFEST] [--verify-hash] [--seed N] [--record FILE]
+ *
+ * - config               -> Pipeline configuration file (built-in default pipeline when omitted).
+ * - --inputs FILE        -> Read the sources from a file (one per line) instead of the built-in list.
+ * - --output FILE        -> Write the results to a columnar binary file instead of printing them.
+ * - --read FILE          -> Print the results stored in a columnar binary file and exit.
+ * - --incremental FILE   -> Skip file:// sources that are unchanged since the run that wrote MANIFEST.
+ * - --verify-hash        -> In incremental mode, also compare content hashes of unchanged files.
+ * - --seed N             -> Seed for the simulated random choices (overrides a recorded seed).
+ * - --record FILE        -> Write the seed and the sources of this run to FILE; replay it with --inputs FILE.
+ */
+struct Options {
+    std::string configPath;
+    std::string inputsPath;
+    std::string outputPath;
+    std::string readPath;
+    std::string manifestPath;
+    std::string recordPath;
+    bool verifyHash = false;
+    bool hasSeed = false;
+    std::uint64_t seed = kDefaultRandomSeed;
+};
+
+/**
+ * Parses the command line into Options. Returns false (after logging) on invalid arguments.
+ */
+static bool ParseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--inputs" && i + 1 < argc) {
+            options.inputsPath = argv[++i];
+        }
+        else if (arg == "--output" && i + 1 < argc) {
+            options.outputPath = argv[++i];
+        }
+        else if (arg == "--read" && i + 1 < argc) {
+            options.readPath = argv[++i];
+        }
+        else if (arg == "--incremental" && i + 1 < argc) {
+            options.manifestPath = argv[++i];
+        }
+        else if (arg == "--verify-hash") {
+            options.verifyHash = true;
+        }
+        else if (arg == "--seed" && i + 1 < argc) {
+            if (!ParseSeed(argv[++i], options.seed)) {
+                std::cerr << "Invalid --seed value: " << argv[i] << " (expected an unsigned 64-bit integer)\n";
+                return false;
+            }
+            options.hasSeed = true;
+        }
+        else if (arg == "--record" && i + 1 < argc) {
+            options.recordPath = argv[++i];
+        }
+        else if (!arg.empty() && arg[0] != '-' && options.configPath.empty()) {
+            options.configPath = arg;
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [config] [--inputs FILE] [--output FILE] [--read FILE]"
+                      << " [--incremental MANIFEST] [--verify-hash] [--seed N] [--record FILE]\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Reads sources from a text file, one per line (blank lines and lines starting with '#' are skipped).
+ * A "# seed: N" line (as written by --record and the LoadGenerator tool) sets `seed` and `hasSeed`.
+ */
+static bool ReadInputs(const std::string& path, std::vector<std::string>& inputs, std::uint64_t& seed, bool& hasSeed) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Cannot open inputs file: " << path << "\n";
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.compare(0, 8, "# seed: ") == 0) {
+            if (!ParseSeed(line.substr(8), seed)) {
+                std::cerr << "Invalid seed line in inputs file " << path << ": " << line << "\n";
+                return false;
+            }
+            hasSeed = true;
+        }
+        if (line.empty() || line[0] == '#') continue;
+        inputs.push_back(line);
+    }
+    return true;
+}
+
+/**
+ * Writes the seed and the sources of a run so that it can be replayed with --inputs.
+ */
+static bool RecordInputs(const std::string& path, const std::vector<std::string>& inputs, std::uint64_t seed) {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        std::cerr << "Cannot write inputs file: " << path << "\n";
+        return false;
+    }
+    file << "# ComputePipeline inputs\n# seed: " << seed << "\n";
+    for (const auto& input : inputs) file << input << "\n";
+    return static_cast<bool>(file.flush());
+}
+
+/**
+ * Prints every row of a columnar result file, reading the strings in place from the mapping.
+ */
+static int PrintResultFile(const std::string& path) {
+    ResultColumnReader reader;
+    if (!reader.Open(path)) return 1;
+
+    for (std::size_t row = 0; row < reader.RowCount(); ++row) {
+        std::cout << "\nSource: "   << reader.Source(row)   << "\n";
+        std::cout << "Protocol: " << reader.Protocol(row) << "\n";
+        std::cout << "Content: "  << reader.Content(row)  << "\n";
+        std::cout << "Metadata:\n";
+        for (std::size_t i = 0; i < reader.MetadataCount(row); ++i) {
+            std::cout << " - " << reader.MetadataKey(row, i) << ": " << reader.MetadataValue(row, i) << "\n";
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[])
 {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) return 1;
+    if (!options.readPath.empty()) return PrintResultFile(options.readPath);
+
+    /**
+     * Pipeline Configuration
+     * ----------------------
+     * The stage graph (stages, accepted/emitted types, threads, queue depths, batch sizes) is read from
+     * the configuration file given on the command line (see config/pipeline.conf).
+     * Without an argument, the built-in default pipeline is used.
+     * The configuration is validated and compiled into a flat dispatch table before any input is loaded.
+     */
+    PipelineConfig config = PipelineConfig::Default();
+    std::vector<std::string> errors;
+    if (!options.configPath.empty() && !LoadPipelineConfig(options.configPath, config, errors)) {
+        for (const auto& error : errors) std::cerr << "Config error: " << error << "\n";
+        return 1;
+    }
+
+    CompiledPipeline pipeline;
+    if (!PipelineManagerFactory::CompilePipeline(config, pipeline, errors)) {
+        for (const auto& error : errors) std::cerr << "Config error: " << error << "\n";
+        return 1;
+    }
+
     // List of input sources to be processed.
     // Each source can be a file, URL, or bundle.
     std::vector<std::string> inputs = {
@@ -16,66 +180,119 @@ int main()
         "bundle://example.zip",
         "ftp://example.jpg",  // Wrong Case (ftp).
         "file://example.exe", // Wrong Test (.exe).
+        "bundle://example.zip", // Duplicate source (shares the first load's result).
     };
+    std::uint64_t seed = kDefaultRandomSeed;
+    bool recordedSeed = false;
+    if (!options.inputsPath.empty()) {
+        inputs.clear();
+        if (!ReadInputs(options.inputsPath, inputs, seed, recordedSeed)) return 1;
+    }
 
-    // Iterate through each input source to process them one by one.
-    for (auto& source : inputs) {
-        std::cout << "\nProcessing: " << source << "\n";
-
-        /**
-         * Loader Selection
-         * ----------------
-         * Use LoaderFactory to select the appropriate Loader for the source.
-         * The selection is based on the protocol (file://, http://, https://, bundle://, etc.).
-         * If no suitable Loader is found, the source is skipped.
-         */
-        std::unique_ptr<ILoader> loader = LoaderFactory::CreateLoader(source);
-
-        if (loader == nullptr) {
-            std::cerr << "No suitable Loader for: " << source << "\n";
-            continue; // Skip this source and continue to the next one.
-        }
+    /**
+     * Deterministic Replay
+     * --------------------
+     * Every simulated random choice is derived from the run seed and the item, so the same inputs and
+     * seed give the same results regardless of thread count or scheduling. --record saves both.
+     */
+    if (options.hasSeed) seed = options.seed;
+    SetRandomSeed(seed);
+    if (!options.recordPath.empty() && !RecordInputs(options.recordPath, inputs, seed)) return 1;
+
+    /**
+     * Incremental Mode
+     * ----------------
+     * With --incremental, file:// sources whose size and modification time (and, with --verify-hash,
+     * content hash) match the manifest are restored from it and never loaded or processed.
+     * Only new or modified sources are sent to the pipeline.
+     */
+    IncrementalManifest manifest;
+    bool incremental = !options.manifestPath.empty();
+    if (incremental && !manifest.Load(options.manifestPath)) return 1;
+    manifest.SetRunContext(DescribeStageGraph(config), seed);
+
+    // File states are captured before loading: a file modified while it is processed keeps its old
+    // fingerprint in the manifest and is processed again next time.
+    std::vector<std::unique_ptr<ActionResult>> slots(inputs.size());
+    std::vector<std::string> pendingSources;
+    std::vector<std::size_t> pendingSlots;
+    std::vector<FileState> pendingStates;
+    std::vector<bool> pendingCaptured;
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        if (incremental && (slots[i] = manifest.Reuse(inputs[i], options.verifyHash))) continue;
+        pendingSources.push_back(inputs[i]);
+        pendingSlots.push_back(i);
+        pendingStates.emplace_back();
+        pendingCaptured.push_back(incremental && CaptureFileState(inputs[i], pendingStates.back()));
+    }
+
+    /**
+     * Process the Batch
+     * -----------------
+     * The PipelineExecutor loads every source with the Loader chosen by LoaderFactory and routes
+     * each ActionResult through the configured stages until it is fully processed.
+     * Sources without a suitable Loader are reported and skipped.
+     */
+    std::unique_ptr<PipelineExecutor> executor = PipelineManagerFactory::CreatePipelineExecutor(pipeline);
+    std::vector<std::unique_ptr<ActionResult>> processed = executor->RunEach(pendingSources);
+    // Stopped items (deadline, cancellation, pass limit) are not recorded and lose any earlier entry,
+    // so they are processed again by the next incremental run.
+    for (std::size_t i = 0; i < processed.size(); ++i) {
+        if (!processed[i]) continue;
+        if (pendingCaptured[i]) manifest.Record(pendingSources[i], pendingStates[i], *processed[i]);
+        slots[pendingSlots[i]] = std::move(processed[i]);
+    }
+    if (incremental) {
+        if (!manifest.Save(options.manifestPath)) return 1;
+        std::cout << "Incremental: " << manifest.ReusedCount() << " unchanged, "
+                  << pendingSources.size() << " sent to the pipeline\n";
+    }
+
+    std::vector<ActionResult> results;
+    results.reserve(slots.size());
+    for (auto& slot : slots) {
+        if (slot) results.push_back(std::move(*slot));
+    }
+    std::cout << "Loads: " << executor->LastRunStats().loads
+              << ", coalesced: " << executor->LastRunStats().coalescedLoads << "\n";
+    std::cout << "Payload memory peak: " << executor->LastRunStats().peakBudgetBytes << " bytes"
+              << " (limit: " << executor->Budget().LimitBytes()
+              << ", waits: " << executor->LastRunStats().budgetWaits << ")\n";
+    if (executor->LastRunStats().stoppedItems > 0) {
+        std::cout << "Stopped early (deadline, cancellation or pass limit): "
+                  << executor->LastRunStats().stoppedItems << "\n";
+    }
+    if (executor->LastRunStats().numaNodes > 1) {
+        std::cout << "NUMA nodes: " << executor->LastRunStats().numaNodes
+                  << ", cross-node stage passes: " << executor->LastRunStats().crossNodeItems << "\n";
+    }
+
+    /**
+     * Store the Results
+     * -----------------
+     * With --output, the results are written to a columnar binary file (one column per field plus
+     * a string dictionary) that downstream tools can map and scan without reparsing text.
+     */
+    if (!options.outputPath.empty()) {
+        ResultColumnWriter writer;
+        for (const auto& item : results) writer.Append(item);
+        if (!writer.WriteFile(options.outputPath)) return 1;
+        std::cout << "Wrote " << writer.RowCount() << " results to " << options.outputPath << "\n";
+        return 0;
+    }
 
-        /**
-         * Load the Item
-         * -------------
-         * Use the selected Loader to load the source.
-         * The Loader initializes an ActionResult object with the source's details.
-         * This includes the source's content, protocol, and metadata.
-         */
-        ActionResult item = loader->Load(source);
-
-        /**
-         * Create PipelineManager
-         * ----------------------
-         * Use the PipelineManagerFactory to create a fully configured PipelineManager.
-         * The PipelineManager is responsible for processing the ActionResult through a series of transformations.
-         * This design allows easy expansion and maintenance by configuring the pipeline in one place.
-         */
-        std::unique_ptr<PipelineManager> pipelineManager = PipelineManagerFactory::CreatePipelineManager();
-
-        /**
-         * Process the Item
-         * ----------------
-         * Pass the loaded ActionResult to the PipelineManager.
-         * The PipelineManager:
-         * - Detects the type of data (IMAGE, JSON, COMPRESSED, UNKNOWN, etc.).
-         * - Chooses the appropriate processing system (e.g., Decompress, DecodeImage, ParseJSON).
-         * - Transforms the item through the pipeline until fully processed.
-         */
-        pipelineManager->Process(item);
-
-        /**
-         * Output the Final Result
-         * -----------------------
-         * After processing, print the final state of the ActionResult.
-         * This includes:
-         * - Source: The original input source.
-         * - Protocol: The detected protocol (file, http, https, bundle, etc.).
-         * - Content: The processed content description.
-         * - Metadata: Key/value pairs containing processing details and actions taken.
-         */
-        std::cout << "Source: "   << item.source   << "\n";
+    /**
+     * Output the Final Results
+     * ------------------------
+     * After processing, print the final state of each ActionResult.
+     * This includes:
+     * - Source: The original input source.
+     * - Protocol: The detected protocol (file, http, https, bundle, etc.).
+     * - Content: The processed content description.
+     * - Metadata: Key/value pairs containing processing details and actions taken.
+     */
+    for (const auto& item : results) {
+        std::cout << "\nSource: "   << item.source   << "\n";
         std::cout << "Protocol: " << item.protocol << "\n";
         std::cout << "Content: "  << item.content  << "\n";
 
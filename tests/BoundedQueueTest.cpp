@@ -0,0 +1,82 @@
+#include "TestSupport.h"
+#include "Utils/BoundedQueue.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+/**
+ * BoundedQueueTest
+ * ----------------
+ * FIFO order, partition preference with its skip bound, stealing from other partitions, draining
+ * after Close and blocking producers at capacity.
+ */
+
+static void CheckFifo() {
+    BoundedQueue<int> queue(8, 3);
+    for (int i = 0; i < 6; ++i) CHECK(queue.Push(i, static_cast<std::size_t>(i % 3)));
+    std::vector<int> out;
+    CHECK(queue.PopBatch(out, 4));
+    CHECK((out == std::vector<int>{ 0, 1, 2, 3 }));
+    out.clear();
+    CHECK(queue.PopBatch(out, 0)); // Treated as 1.
+    CHECK((out == std::vector<int>{ 4 }));
+}
+
+static void CheckPreference() {
+    // Partition 1 holds the oldest item, partition 0 the next ones: a worker of partition 0 takes
+    // its own items until the old one has been skipped `maxSkips` times, then takes it.
+    BoundedQueue<int> queue(64, 2);
+    CHECK(queue.Push(100, 1));
+    for (int i = 0; i < 10; ++i) CHECK(queue.Push(i, 0));
+    std::vector<int> out;
+    CHECK(queue.PopBatchPreferring(out, 5, 0, 3));
+    CHECK((out == std::vector<int>{ 0, 1, 2, 100, 3 }));
+
+    // Without a bound that matters, only an empty own partition makes the worker steal.
+    out.clear();
+    CHECK(queue.Push(200, 1));
+    CHECK(queue.PopBatchPreferring(out, 8, 0, 1000));
+    CHECK((out == std::vector<int>{ 4, 5, 6, 7, 8, 9, 200 }));
+
+    // Out-of-range partitions fall back to partition 0.
+    out.clear();
+    CHECK(queue.Push(7, 9));
+    CHECK(queue.PopBatchPreferring(out, 1, 5, 0));
+    CHECK((out == std::vector<int>{ 7 }));
+}
+
+static void CheckCloseAndCapacity() {
+    BoundedQueue<int> queue(2, 2);
+    CHECK(queue.Push(1, 0));
+    CHECK(queue.Push(2, 1));
+
+    std::atomic<bool> pushed(false);
+    std::thread producer([&] {
+        queue.Push(3, 0);
+        pushed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK(!pushed); // Full: the producer blocks.
+
+    std::vector<int> out;
+    CHECK(queue.PopBatch(out, 1));
+    producer.join();
+    CHECK(pushed);
+
+    queue.Close();
+    CHECK(!queue.Push(4, 0));
+    out.clear();
+    CHECK(queue.PopBatchPreferring(out, 8, 1, 0));
+    CHECK((out == std::vector<int>{ 2, 3 }));
+    out.clear();
+    CHECK(!queue.PopBatch(out, 8));
+    CHECK(out.empty());
+}
+
+int main() {
+    CheckFifo();
+    CheckPreference();
+    CheckCloseAndCapacity();
+    return TestResult();
+}
@@ -0,0 +1,184 @@
+#include "TestSupport.h"
+#include "Core/MemoryBudget.h"
+#include "Factories/PipelineManagerFactory.h"
+#include "Loaders/FileLoader.h"
+#include "Loaders/HttpLoader.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * CancellationTest
+ * ----------------
+ * Item deadlines, batch deadlines and batch cancellation through a token stop items in the executor,
+ * and cut short the waits inside Load (simulated HTTP latency, exhausted memory budget) and, in the
+ * C++20 build, inside LoadAsync (suspended on a scheduler or sleeping outside one).
+ */
+
+using Clock = std::chrono::steady_clock;
+
+static long ElapsedMs(Clock::time_point start) {
+    return static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count());
+}
+
+// HTTP sources whose simulated round trip (10 s) is far longer than any deadline below.
+static std::unique_ptr<PipelineExecutor> SlowHttpExecutor(std::size_t itemTimeoutMs, std::size_t batchTimeoutMs) {
+    PipelineConfig config = PipelineConfig::Default();
+    config.loaderThreads = 2;
+    config.httpLatencyMs = 10000;
+    config.itemTimeoutMs = itemTimeoutMs;
+    config.batchTimeoutMs = batchTimeoutMs;
+    CompiledPipeline pipeline;
+    std::vector<std::string> errors;
+    CHECK(PipelineManagerFactory::CompilePipeline(config, pipeline, errors));
+    return PipelineManagerFactory::CreatePipelineExecutor(pipeline);
+}
+
+static const std::vector<std::string> kSources = { "http://example.com/a.jpg", "https://example.com/b.json",
+                                                   "http://example.com/c.jpg", "https://example.com/d.json" };
+
+// Every source has a stopped result with `reason`, and the run ended long before the latency.
+static void CheckStopped(PipelineExecutor& executor, const std::vector<std::unique_ptr<ActionResult>>& results,
+                         const std::string& reason, Clock::time_point start) {
+    CHECK(ElapsedMs(start) < 5000);
+    CHECK(results.size() == kSources.size());
+    for (const auto& result : results) {
+        CHECK(result != nullptr);
+        if (!result) continue;
+        CHECK(result->isProcessed);
+        CHECK(result->metadata["Pipeline Stopped"] == reason);
+        CHECK(result->data.empty());
+    }
+    CHECK(executor.LastRunStats().stoppedItems == kSources.size());
+    CHECK(executor.Budget().CurrentBytes() == 0);
+}
+
+static void CheckItemDeadline() {
+    std::unique_ptr<PipelineExecutor> executor = SlowHttpExecutor(50, 0);
+    Clock::time_point start = Clock::now();
+    std::vector<std::unique_ptr<ActionResult>> results = executor->RunEach(kSources);
+    CheckStopped(*executor, results, "Deadline exceeded", start);
+}
+
+static void CheckBatchDeadline() {
+    std::unique_ptr<PipelineExecutor> executor = SlowHttpExecutor(0, 50);
+    Clock::time_point start = Clock::now();
+    std::vector<std::unique_ptr<ActionResult>> results = executor->RunEach(kSources);
+    CheckStopped(*executor, results, "Deadline exceeded", start);
+}
+
+static void CheckBatchCancelled() {
+    std::unique_ptr<PipelineExecutor> executor = SlowHttpExecutor(0, 0);
+    CancellationToken cancel = CancellationToken::Create();
+    Clock::time_point start = Clock::now();
+    std::thread canceller([cancel] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        cancel.Cancel();
+    });
+    std::vector<std::unique_ptr<ActionResult>> results = executor->RunEach(kSources, cancel);
+    canceller.join();
+    CheckStopped(*executor, results, "Cancelled", start);
+}
+
+// A loader waiting for budget gives up when its token is cancelled, and returns an empty stopped item.
+static void CheckBudgetWait() {
+    MemoryBudget budget(150);
+    BudgetReservation held(&budget, 150);
+
+    CancellationToken token = CancellationToken::Create().WithDeadline(Clock::now() + std::chrono::milliseconds(50));
+    FileLoader loader;
+    loader.SetMemoryBudget(&budget);
+    loader.SetCancellation(token);
+    Clock::time_point start = Clock::now();
+    ActionResult item = loader.Load("file://photo.jpg");
+    CHECK(ElapsedMs(start) < 5000);
+    CHECK(item.isProcessed && item.data.empty());
+    CHECK(item.metadata["Pipeline Stopped"] == "Deadline exceeded");
+    CHECK(budget.CurrentBytes() == 150);
+
+    // The token only matters while waiting: once the budget is released, the reservation succeeds.
+    CHECK(!budget.Reserve(100, token));
+    held.Release();
+    CHECK(budget.Reserve(100, token));
+    CHECK(budget.CurrentBytes() == 100);
+
+    // An uncancelled loader attaches its token to the item and fills the payload.
+    CancellationToken open = CancellationToken::Create();
+    HttpLoader http;
+    http.SetCancellation(open);
+    ActionResult loaded = http.Load("http://example.com/a.jpg");
+    CHECK(!loaded.isProcessed && loaded.data.size() == 200);
+    open.Cancel();
+    CHECK(loaded.cancellation.IsCancelled());
+}
+
+#ifdef COMPUTE_PIPELINE_COROUTINES
+// Awaits loader.LoadAsync(source) into `out`, then sets `done`.
+static DetachedTask LoadInto(HttpLoader& loader, std::string source, ActionResult& out, std::atomic<bool>& done) {
+    out = co_await loader.LoadAsync(std::move(source));
+    done = true;
+}
+
+// The coroutine load stops waiting for the simulated latency as soon as its token trips, whether it
+// is suspended on a scheduler timer or sleeping outside a scheduler, and returns an empty stopped item.
+static void CheckAsyncLatencyWait() {
+    for (bool onScheduler : { true, false }) {
+        for (bool explicitCancel : { false, true }) {
+            CancellationToken token = CancellationToken::Create();
+            if (!explicitCancel) token = token.WithDeadline(Clock::now() + std::chrono::milliseconds(50));
+            HttpLoader http;
+            http.SetSimulatedLatency(std::chrono::milliseconds(10000));
+            http.SetCancellation(token);
+            std::thread canceller([token, explicitCancel] {
+                if (!explicitCancel) return;
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                token.Cancel();
+            });
+
+            ActionResult item(DataType::UNKNOWN, std::string(), "none"_sr, "Not Loaded"_sr);
+            std::atomic<bool> done(false);
+            Clock::time_point start = Clock::now();
+            if (onScheduler) {
+                CoroutineScheduler scheduler(1);
+                scheduler.Post(LoadInto(http, "http://example.com/a.jpg", item, done).Handle());
+                while (!done && ElapsedMs(start) < 5000) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            else {
+                LoadInto(http, "http://example.com/a.jpg", item, done).Handle().resume();
+            }
+            canceller.join();
+            CHECK(done && ElapsedMs(start) < 5000);
+            CHECK(item.isProcessed && item.data.empty());
+            CHECK(item.source == "http://example.com/a.jpg");
+            CHECK(item.metadata["Pipeline Stopped"] == (explicitCancel ? "Cancelled" : "Deadline exceeded"));
+        }
+    }
+
+    // An item cancelled before the load does not wait at all.
+    CancellationToken cancelled = CancellationToken::Create();
+    cancelled.Cancel();
+    HttpLoader http;
+    http.SetSimulatedLatency(std::chrono::milliseconds(10000));
+    http.SetCancellation(cancelled);
+    ActionResult item(DataType::UNKNOWN, std::string(), "none"_sr, "Not Loaded"_sr);
+    std::atomic<bool> done(false);
+    Clock::time_point start = Clock::now();
+    LoadInto(http, "http://example.com/b.json", item, done).Handle().resume();
+    CHECK(done && ElapsedMs(start) < 1000);
+    CHECK(item.metadata["Pipeline Stopped"] == "Cancelled");
+}
+#endif
+
+int main() {
+    QuietOutput quiet;
+    CheckItemDeadline();
+    CheckBatchDeadline();
+    CheckBatchCancelled();
+    CheckBudgetWait();
+#ifdef COMPUTE_PIPELINE_COROUTINES
+    CheckAsyncLatencyWait();
+#endif
+    return TestResult();
+}
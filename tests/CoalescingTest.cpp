@@ -0,0 +1,71 @@
+#include "TestSupport.h"
+#include "Factories/PipelineManagerFactory.h"
+#include "Utils/InFlightTable.h"
+#include <string>
+#include <vector>
+
+/**
+ * CoalescingTest
+ * --------------
+ * Duplicate sources in flight are loaded once and every request gets the finished result, and the
+ * in-flight table forgets a source once its waiters have been served.
+ */
+
+static void CheckTable() {
+    InFlightTable table(4);
+    CHECK(table.Acquire("file://a.jpg", 0) == InFlightTable::Claim::LEADER);
+    CHECK(table.Acquire("file://a.jpg", 1) == InFlightTable::Claim::WAITING);
+    CHECK(table.Acquire("file://a.jpg", 2) == InFlightTable::Claim::WAITING);
+    CHECK(table.Acquire("file://b.jpg", 3) == InFlightTable::Claim::LEADER);
+    CHECK(table.InFlightCount() == 2);
+
+    std::vector<std::size_t> waiters = table.Complete("file://a.jpg");
+    CHECK(waiters.size() == 2 && waiters[0] == 1 && waiters[1] == 2);
+    CHECK(table.InFlightCount() == 1);
+    CHECK(table.Complete("file://a.jpg").empty());
+
+    // Once dropped, the next request for the source leads again.
+    CHECK(table.Acquire("file://a.jpg", 4) == InFlightTable::Claim::LEADER);
+    CHECK(table.Complete("file://b.jpg").empty());
+    CHECK(table.Complete("file://a.jpg").empty());
+    CHECK(table.InFlightCount() == 0);
+    CHECK(table.LeaderCount() == 3 && table.CoalescedCount() == 2);
+}
+
+// The first loader sleeps in the HTTP stub while the second one claims the duplicates, so they are
+// all attached to the leader.
+static void CheckExecutor() {
+    CompiledPipeline pipeline;
+    std::vector<std::string> errors;
+    PipelineConfig config = PipelineConfig::Default();
+    config.loaderThreads = 2;
+    config.httpLatencyMs = 200;
+    CHECK(PipelineManagerFactory::CompilePipeline(config, pipeline, errors));
+
+    std::vector<std::string> sources(6, "http://example.com/photo.jpg");
+    sources.push_back("file://other.json");
+    std::unique_ptr<PipelineExecutor> executor = PipelineManagerFactory::CreatePipelineExecutor(pipeline);
+    std::vector<std::unique_ptr<ActionResult>> results = executor->RunEach(sources);
+
+    CHECK(executor->LastRunStats().loads == 2);
+    CHECK(executor->LastRunStats().coalescedLoads == 5);
+    CHECK(results.size() == sources.size());
+    for (std::size_t i = 0; i + 1 < results.size(); ++i) {
+        CHECK(results[i] != nullptr);
+        if (!results[i]) continue;
+        CHECK(results[i]->isProcessed);
+        CHECK(results[i]->source == sources[i]);
+        CHECK(results[i]->content == "Decoded Image");
+        CHECK(results[i]->metadata == results[0]->metadata);
+        // Followers share the leader's finished result, which never holds a payload.
+        CHECK(results[i]->data.empty());
+    }
+    CHECK(results.back() && results.back()->content == "JSON Parsed");
+}
+
+int main() {
+    QuietOutput quiet;
+    CheckTable();
+    CheckExecutor();
+    return TestResult();
+}
@@ -0,0 +1,132 @@
+#include "TestSupport.h"
+#include "Core/ActionResult.h"
+#include "Factories/LoaderFactory.h"
+#include "Factories/PipelineManagerFactory.h"
+#include "Utils/RandomSelector.h"
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * CopyCountTest
+ * -------------
+ * Proves that an item is never copied on its way from ILoader::Load through PipelineManager::Process
+ * into the result list: ActionResult is move-only, Load copies the source exactly once (into the
+ * item), and no allocation the size of the source string or of the payload happens after loading
+ * (any string or payload copy would need one).
+ *
+ * Allocation sizes are recorded by replacing the global operator new for this executable.
+ */
+
+static_assert(!std::is_copy_constructible<ActionResult>::value, "ActionResult must not be copyable");
+static_assert(!std::is_copy_assignable<ActionResult>::value, "ActionResult must not be copy-assignable");
+static_assert(std::is_move_constructible<ActionResult>::value, "ActionResult must be movable");
+static_assert(!std::is_convertible<char (&)[8], StringRef>::value, "StringRef must not wrap char arrays implicitly");
+static_assert(!std::is_convertible<const char*, StringRef>::value, "StringRef must not wrap raw pointers implicitly");
+
+namespace {
+
+bool recording = false;
+std::size_t recordedCount = 0;
+std::size_t recordedSizes[4096];
+
+void BeginRecording() {
+    recordedCount = 0;
+    recording = true;
+}
+
+void EndRecording() { recording = false; }
+
+// Number of recorded allocations whose size satisfies `match`.
+template <typename Predicate>
+std::size_t CountAllocations(Predicate match) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < recordedCount && i < 4096; ++i) count += match(recordedSizes[i]) ? 1 : 0;
+    return count;
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    if (recording) {
+        if (recordedCount < 4096) recordedSizes[recordedCount] = size;
+        ++recordedCount;
+    }
+    void* pointer = std::malloc(size > 0 ? size : 1);
+    if (pointer == nullptr) throw std::bad_alloc();
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+
+// Follows one source through Load, Process and the hand-off into `results`.
+static void CheckNoCopies(const std::string& source, PipelineManager& manager, std::vector<ActionResult>& results) {
+    std::unique_ptr<ILoader> loader = LoaderFactory::CreateLoader(source);
+    CHECK(loader != nullptr);
+    if (!loader) return;
+
+    // The source is longer than any metadata value, payload or processor-created string, so a copy
+    // of it would show up as an allocation of at least its length.
+    std::size_t sourceSize = source.size() + 1;
+    BeginRecording();
+    ActionResult item = loader->Load(source);
+    EndRecording();
+    std::size_t payloadSize = item.data.size();
+    CHECK(payloadSize > 0 && payloadSize < sourceSize);
+    CHECK(CountAllocations([sourceSize](std::size_t size) { return size >= sourceSize; }) == 1);
+    CHECK(CountAllocations([payloadSize](std::size_t size) { return size == payloadSize; }) == 1);
+
+    BeginRecording();
+    manager.Process(item);
+    results.push_back(std::move(item));
+    EndRecording();
+    CHECK(CountAllocations([sourceSize](std::size_t size) { return size >= sourceSize; }) == 0);
+    CHECK(CountAllocations([payloadSize](std::size_t size) { return size == payloadSize; }) == 0);
+    CHECK(results.back().isProcessed);
+    CHECK(results.back().data.empty());
+}
+
+int main() {
+    QuietOutput quiet;
+    std::string longName(400, 'n');
+
+    // With seed 4 the archive decompresses to .json, so the in-place extension replacement grows the
+    // source; the headroom reserved by the loader must absorb it without reallocating.
+    std::string archive = "bundle://" + longName + ".zip";
+    SetRandomSeed(4);
+    CHECK(GetRandomExtension(archive, 0) == ".json");
+
+    std::unique_ptr<PipelineManager> manager = PipelineManagerFactory::CreatePipelineManager();
+    std::vector<ActionResult> results;
+    results.reserve(8);
+    CheckNoCopies("file://" + longName + ".json", *manager, results);
+    CheckNoCopies("http://" + longName + ".jpg", *manager, results);
+    CheckNoCopies(archive, *manager, results);
+    CHECK(results.back().source == "bundle://" + longName + ".json");
+
+    // The counter does see real copies: an explicit Clone copies the source and the payload.
+    std::unique_ptr<ILoader> loader = LoaderFactory::CreateLoader(archive);
+    ActionResult original = loader->Load(archive);
+    std::size_t sourceSize = original.source.size() + 1;
+    std::size_t payloadSize = original.data.size();
+    BeginRecording();
+    ActionResult copy = original.Clone();
+    EndRecording();
+    CHECK(CountAllocations([sourceSize](std::size_t size) { return size >= sourceSize; }) >= 1);
+    CHECK(CountAllocations([payloadSize](std::size_t size) { return size == payloadSize; }) == 1);
+
+    // Literals are referenced, runtime values are owned.
+    StringRef literal = "Decoded Image"_sr;
+    CHECK(literal.IsStatic());
+    CHECK(literal.size() == 13);
+    CHECK(literal == "Decoded Image");
+    StringRef owned(std::string("restored"));
+    CHECK(!owned.IsStatic());
+    CHECK(owned.size() == 8);
+
+    return TestResult();
+}
@@ -0,0 +1,104 @@
+#include "TestSupport.h"
+
+/**
+ * CoroutineExecutorTest
+ * ---------------------
+ * The coroutine executor (C++20 build only) produces the same results as the thread-pool executor,
+ * creates at most one processor per stage per lane, and stops items past their deadline or in a
+ * cancelled batch while they are still waiting on I/O.
+ */
+
+#ifdef COMPUTE_PIPELINE_COROUTINES
+
+#include "Factories/PipelineManagerFactory.h"
+#include "Systems/CoroutineExecutor.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main() {
+    QuietOutput quiet;
+    CompiledPipeline pipeline;
+    std::vector<std::string> errors;
+    PipelineConfig config = PipelineConfig::Default();
+    config.httpLatencyMs = 1;
+    CHECK(PipelineManagerFactory::CompilePipeline(config, pipeline, errors));
+
+    // Count processor creations by wrapping each stage's factory.
+    std::shared_ptr<std::atomic<std::size_t>> created = std::make_shared<std::atomic<std::size_t>>(0);
+    CompiledPipeline counted = pipeline;
+    for (CompiledStage& stage : counted.stages) {
+        std::function<std::unique_ptr<IProcessor>()> create = stage.createProcessor;
+        stage.createProcessor = [create, created] {
+            ++*created;
+            return create();
+        };
+    }
+
+    std::vector<std::string> sources;
+    for (int i = 0; i < 200; ++i) {
+        const char* extensions[] = { ".jpg", ".json", ".zip", ".txt" };
+        sources.push_back("http://example.com/item" + std::to_string(i) + extensions[i % 4]);
+    }
+
+    const std::size_t lanes = 4;
+    CoroutineExecutor executor(counted, 2, lanes);
+    std::vector<std::unique_ptr<ActionResult>> results = executor.RunEach(sources);
+    CHECK(*created <= lanes * counted.stages.size());
+    CHECK(*created >= counted.stages.size() - 1);
+
+    PipelineExecutor reference(pipeline);
+    std::vector<std::unique_ptr<ActionResult>> expected = reference.RunEach(sources);
+    CHECK(results.size() == expected.size());
+    for (std::size_t i = 0; i < results.size() && i < expected.size(); ++i) {
+        CHECK(results[i] && expected[i]);
+        if (!results[i] || !expected[i]) continue;
+        CHECK(results[i]->source == expected[i]->source);
+        CHECK(results[i]->type == expected[i]->type);
+        CHECK(results[i]->metadata == expected[i]->metadata);
+    }
+
+    // An item deadline far shorter than the HTTP round trip stops every item while it is still
+    // waiting: the run ends long before the 3 s latency.
+    using Clock = std::chrono::steady_clock;
+    config.httpLatencyMs = 3000;
+    config.itemTimeoutMs = 10;
+    CHECK(PipelineManagerFactory::CompilePipeline(config, pipeline, errors));
+    CoroutineExecutor slow(pipeline, 2, 8);
+    std::vector<std::string> few(sources.begin(), sources.begin() + 8);
+    Clock::time_point start = Clock::now();
+    std::vector<std::unique_ptr<ActionResult>> stopped = slow.RunEach(few);
+    CHECK(Clock::now() - start < std::chrono::milliseconds(1000));
+    CHECK(stopped.size() == few.size());
+    for (const auto& result : stopped) {
+        CHECK(result && result->metadata["Pipeline Stopped"] == "Deadline exceeded" && result->data.empty());
+    }
+
+    // Cancelling the batch token from another thread wakes the suspended loads too.
+    config.itemTimeoutMs = 0;
+    CHECK(PipelineManagerFactory::CompilePipeline(config, pipeline, errors));
+    CoroutineExecutor cancellable(pipeline, 2, 8);
+    CancellationToken cancel = CancellationToken::Create();
+    std::thread canceller([cancel] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        cancel.Cancel();
+    });
+    start = Clock::now();
+    stopped = cancellable.RunEach(few, cancel);
+    canceller.join();
+    CHECK(Clock::now() - start < std::chrono::milliseconds(1000));
+    for (const auto& result : stopped) {
+        CHECK(result && result->metadata["Pipeline Stopped"] == "Cancelled");
+    }
+
+    return TestResult();
+}
+
+#else
+
+int main() { return 0; }
+
+#endif
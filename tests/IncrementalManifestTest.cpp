@@ -0,0 +1,219 @@
+#include "TestSupport.h"
+#include "Factories/PipelineManagerFactory.h"
+#include "Utils/IncrementalManifest.h"
+#include "Utils/PipelineConfig.h"
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include <sys/time.h>
+
+/**
+ * IncrementalManifestTest
+ * -----------------------
+ * Reuse of unchanged sources across a save and load, invalidation by file changes, by the run
+ * context (stage graph, seed) and by changes made while a file was being processed. Stopped items
+ * are not recorded, and entry lines with partly numeric or out-of-range fields are rejected.
+ */
+
+static void WriteFile(const std::string& path, const std::string& text, long mtimeSeconds) {
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << text;
+    }
+    struct timeval times[2] = { { mtimeSeconds, 0 }, { mtimeSeconds, 0 } };
+    ::utimes(path.c_str(), times);
+}
+
+static ActionResult MakeResult(const std::string& source) {
+    ActionResult item(DataType::JSON, source, "file"_sr, "JSON Parsed"_sr);
+    item.isProcessed = true;
+    item.metadata["Action"] = "JSON Parsed";
+    item.metadata["Odd\tKey"] = "line one\nline two \\ end";
+    return item;
+}
+
+// Returns `line` with tab-separated field `index` replaced by `value`.
+static std::string ReplaceField(const std::string& line, std::size_t index, const std::string& value) {
+    std::vector<std::string> fields;
+    std::istringstream stream(line);
+    for (std::string field; std::getline(stream, field, '\t');) fields.push_back(field);
+    if (index < fields.size()) fields[index] = value;
+    std::string joined;
+    for (std::size_t i = 0; i < fields.size(); ++i) joined += (i ? "\t" : "") + fields[i];
+    return joined;
+}
+
+// Writes a manifest holding only `line` and reports whether Load accepts it.
+static bool LoadsLine(const std::string& manifestPath, const std::string& line) {
+    std::ofstream(manifestPath, std::ios::trunc) << "ComputePipeline manifest 2\n" << line << "\n";
+    IncrementalManifest manifest;
+    return manifest.Load(manifestPath);
+}
+
+int main() {
+    QuietOutput quiet;
+    std::string path = TempPath("data.json");
+    std::string source = "file://" + path;
+    std::string manifestPath = TempPath("manifest.txt");
+    std::string graph = DescribeStageGraph(PipelineConfig::Default());
+    WriteFile(path, "{\"a\": 1}", 1000000);
+
+    // First run: nothing to reuse; record the state captured before "loading".
+    {
+        IncrementalManifest manifest;
+        CHECK(manifest.Load(manifestPath));
+        manifest.SetRunContext(graph, 7);
+        CHECK(manifest.Reuse(source, false) == nullptr);
+        FileState state;
+        CHECK(CaptureFileState(source, state));
+        CHECK(state.fingerprint.size == 8);
+        manifest.Record(source, state, MakeResult(source));
+        CHECK(!CaptureFileState("http://example.com/data.json", state));
+        CHECK(manifest.Save(manifestPath));
+    }
+
+    // Same context, unchanged file: reused with metadata intact (escaping round trip).
+    {
+        IncrementalManifest manifest;
+        CHECK(manifest.Load(manifestPath));
+        manifest.SetRunContext(graph, 7);
+        std::unique_ptr<ActionResult> item = manifest.Reuse(source, true);
+        CHECK(item != nullptr);
+        if (item) {
+            CHECK(item->type == DataType::JSON && item->isProcessed);
+            CHECK(item->content == "JSON Parsed");
+            CHECK(item->metadata["Odd\tKey"] == "line one\nline two \\ end");
+            CHECK(item->metadata.count("Incremental") == 1);
+        }
+        CHECK(manifest.ReusedCount() == 1);
+    }
+
+    // Another seed or another stage graph: not reused.
+    {
+        IncrementalManifest manifest;
+        CHECK(manifest.Load(manifestPath));
+        manifest.SetRunContext(graph, 8);
+        CHECK(manifest.Reuse(source, false) == nullptr);
+
+        PipelineConfig changed = PipelineConfig::Default();
+        changed.stages[0].emits.pop_back();
+        manifest.SetRunContext(DescribeStageGraph(changed), 7);
+        CHECK(manifest.Reuse(source, false) == nullptr);
+
+        PipelineConfig tuned = PipelineConfig::Default();
+        tuned.stages[0].threads = 8;
+        tuned.loaderThreads = 4;
+        manifest.SetRunContext(DescribeStageGraph(tuned), 7);
+        CHECK(manifest.Reuse(source, false) != nullptr);
+    }
+
+    // Changed file (same size, new mtime; then same mtime, new contents with --verify-hash).
+    {
+        WriteFile(path, "{\"a\": 2}", 1000001);
+        IncrementalManifest manifest;
+        CHECK(manifest.Load(manifestPath));
+        manifest.SetRunContext(graph, 7);
+        CHECK(manifest.Reuse(source, false) == nullptr);
+        WriteFile(path, "{\"a\": 2}", 1000000);
+        CHECK(manifest.Reuse(source, false) != nullptr);
+        CHECK(manifest.Reuse(source, true) == nullptr);
+    }
+
+    // A file modified while it was being processed is recorded with the state from before the load,
+    // so the next run processes it again.
+    {
+        IncrementalManifest manifest;
+        CHECK(manifest.Load(manifestPath));
+        manifest.SetRunContext(graph, 7);
+        FileState beforeLoad;
+        CHECK(CaptureFileState(source, beforeLoad));
+        WriteFile(path, "{\"a\": 3, \"b\": 4}", 1000002);
+        manifest.Record(source, beforeLoad, MakeResult(source));
+        CHECK(manifest.Save(manifestPath));
+
+        IncrementalManifest next;
+        CHECK(next.Load(manifestPath));
+        next.SetRunContext(graph, 7);
+        CHECK(next.Reuse(source, false) == nullptr);
+    }
+
+    // An item stopped by a cancelled batch is not recorded and drops the source's earlier entry, so
+    // the next run processes it again.
+    {
+        IncrementalManifest manifest;
+        CHECK(manifest.Load(manifestPath));
+        manifest.SetRunContext(graph, 7);
+        FileState state;
+        CHECK(CaptureFileState(source, state));
+        CHECK(manifest.Record(source, state, MakeResult(source)));
+        CHECK(manifest.Reuse(source, false) != nullptr);
+
+        CompiledPipeline pipeline;
+        std::vector<std::string> errors;
+        CHECK(PipelineManagerFactory::CompilePipeline(PipelineConfig::Default(), pipeline, errors));
+        CancellationToken cancel = CancellationToken::Create();
+        cancel.Cancel();
+        std::unique_ptr<PipelineExecutor> executor = PipelineManagerFactory::CreatePipelineExecutor(pipeline);
+        std::vector<std::unique_ptr<ActionResult>> results = executor->RunEach({ source }, cancel);
+        CHECK(results.size() == 1 && results[0] != nullptr);
+        if (results.size() == 1 && results[0]) {
+            CHECK(results[0]->metadata["Pipeline Stopped"] == "Cancelled");
+            CHECK(!manifest.Record(source, state, *results[0]));
+        }
+        CHECK(manifest.RecordedCount() == 1);
+        CHECK(manifest.Save(manifestPath));
+
+        IncrementalManifest next;
+        CHECK(next.Load(manifestPath));
+        next.SetRunContext(graph, 7);
+        CHECK(next.Reuse(source, false) == nullptr);
+    }
+
+    // Every numeric and flag field of an entry must parse completely and fit its type.
+    {
+        IncrementalManifest manifest;
+        manifest.SetRunContext(graph, 7);
+        FileState state;
+        CHECK(CaptureFileState(source, state));
+        CHECK(manifest.Record(source, state, MakeResult(source)));
+        CHECK(manifest.Save(manifestPath));
+        std::ifstream saved(manifestPath);
+        std::string header, line;
+        std::getline(saved, header);
+        std::getline(saved, line);
+        saved.close();
+        CHECK(LoadsLine(manifestPath, line));
+        CHECK(LoadsLine(manifestPath, ReplaceField(line, 3, "-5")));
+
+        const std::pair<std::size_t, const char*> damaged[] = {
+            { 1, "" }, { 1, "12g" }, { 1, " 12" }, { 1, "-1" }, { 1, "1ffffffffffffffff" },
+            { 2, "8x" }, { 2, "+8" }, { 2, "99999999999999999999" },
+            { 3, "" }, { 3, "1e9" }, { 3, "-" }, { 3, "9223372036854775808" },
+            { 4, "0x10" }, { 8, "" }, { 8, "2" }, { 8, "1 " }, { 9, "2 " }, { 9, "-0" },
+        };
+        for (const auto& field : damaged) CHECK(!LoadsLine(manifestPath, ReplaceField(line, field.first, field.second)));
+
+        // The shared FNV-1a helper hashes file contents (reference value for "a" from the FNV spec).
+        std::uint64_t hash = 0;
+        CHECK(HashFile(path, hash) && hash == Fnv1a("{\"a\": 3, \"b\": 4}") && hash == state.hash);
+        CHECK(Fnv1a("a") == 0xaf63dc4c8601ec8cull && Fnv1a("") == kFnv1aOffsetBasis);
+    }
+
+    // Manifests of an older format are discarded; garbage is rejected.
+    {
+        std::ofstream(manifestPath, std::ios::trunc) << "ComputePipeline manifest 1\n" << source << "\t8\t0\t0\n";
+        IncrementalManifest manifest;
+        CHECK(manifest.Load(manifestPath));
+        manifest.SetRunContext(graph, 7);
+        CHECK(manifest.Reuse(source, false) == nullptr);
+        std::ofstream(manifestPath, std::ios::trunc) << "not a manifest\n";
+        CHECK(!manifest.Load(manifestPath));
+        std::ofstream(manifestPath, std::ios::trunc) << "ComputePipeline manifest 2\n" << source << "\t0\t8\t0\t0\n";
+        CHECK(!manifest.Load(manifestPath));
+    }
+
+    return TestResult();
+}
@@ -0,0 +1,109 @@
+#include "TestSupport.h"
+#include "Core/MemoryBudget.h"
+#include "Factories/PipelineManagerFactory.h"
+#include "Utils/PipelineConfig.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * MemoryBudgetTest
+ * ----------------
+ * Reservation gauges, blocking and oversize admission of MemoryBudget, per-run peak reporting by the
+ * executor, and parsing of `[memory] limit` byte sizes.
+ */
+
+static void CheckBudget() {
+    MemoryBudget budget(300);
+    {
+        BudgetReservation first(&budget, 200);
+        BudgetReservation second(&budget, 100);
+        CHECK(budget.CurrentBytes() == 300 && budget.PeakBytes() == 300);
+
+        // A reservation that does not fit waits until budget is released.
+        std::atomic<bool> reserved(false);
+        std::thread waiter([&budget, &reserved] {
+            BudgetReservation third(&budget, 150);
+            reserved = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        CHECK(!reserved);
+        first.Release();
+        waiter.join();
+        CHECK(reserved);
+        CHECK(budget.WaitCount() == 1);
+    }
+    CHECK(budget.CurrentBytes() == 0);
+    CHECK(budget.PeakBytes() == 300);
+    budget.ResetPeak();
+    CHECK(budget.PeakBytes() == 0);
+
+    // A payload larger than the whole limit is admitted alone, without waiting.
+    {
+        BudgetReservation oversized(&budget, 1000);
+        CHECK(budget.CurrentBytes() == 1000 && budget.WaitCount() == 1);
+    }
+
+    // Moving a reservation transfers it; the bytes are returned exactly once.
+    MemoryBudget unlimited;
+    BudgetReservation moved;
+    {
+        BudgetReservation original(&unlimited, 64);
+        moved = std::move(original);
+    }
+    CHECK(unlimited.CurrentBytes() == 64);
+    moved.Release();
+    CHECK(unlimited.CurrentBytes() == 0);
+}
+
+// FileLoader payloads are 100 bytes; a 300 byte budget caps four loaders at three payloads at once.
+static void CheckExecutorPeak() {
+    PipelineConfig config = PipelineConfig::Default();
+    config.loaderThreads = 4;
+    config.memoryLimitBytes = 300;
+    CompiledPipeline pipeline;
+    std::vector<std::string> errors;
+    CHECK(PipelineManagerFactory::CompilePipeline(config, pipeline, errors));
+    std::unique_ptr<PipelineExecutor> executor = PipelineManagerFactory::CreatePipelineExecutor(pipeline);
+
+    std::vector<std::string> sources;
+    for (int i = 0; i < 200; ++i) sources.push_back("file://item" + std::to_string(i) + ".json");
+    std::vector<ActionResult> results = executor->Run(sources);
+    CHECK(results.size() == sources.size());
+    CHECK(executor->LastRunStats().peakBudgetBytes > 0);
+    CHECK(executor->LastRunStats().peakBudgetBytes <= 300);
+    CHECK(executor->Budget().CurrentBytes() == 0);
+
+    // The peak is per run: a run that loads nothing reports none.
+    executor->Run(std::vector<std::string>());
+    CHECK(executor->LastRunStats().peakBudgetBytes == 0);
+    CHECK(executor->LastRunStats().budgetWaits == 0);
+}
+
+static void CheckByteSizes() {
+    std::size_t bytes = 0;
+    CHECK(ParseByteSize("0", bytes) && bytes == 0);
+    CHECK(ParseByteSize("512K", bytes) && bytes == 512u * 1024u);
+    CHECK(ParseByteSize("256 M", bytes) && bytes == 256u * 1024u * 1024u);
+    CHECK(ParseByteSize("1g", bytes) && bytes == std::size_t(1) << 30);
+    CHECK(ParseByteSize("18446744073709551615", bytes) && bytes == static_cast<std::size_t>(-1));
+    bytes = 7;
+    CHECK(!ParseByteSize("99999999999G", bytes));
+    CHECK(!ParseByteSize("18446744073709551616", bytes));
+    CHECK(!ParseByteSize("17179869184G", bytes));
+    CHECK(!ParseByteSize("", bytes));
+    CHECK(!ParseByteSize("G", bytes));
+    CHECK(!ParseByteSize("-1M", bytes));
+    CHECK(!ParseByteSize("1T", bytes));
+    CHECK(bytes == 7);
+}
+
+int main() {
+    QuietOutput quiet;
+    CheckBudget();
+    CheckExecutorPeak();
+    CheckByteSizes();
+    return TestResult();
+}
@@ -0,0 +1,127 @@
+#include "TestSupport.h"
+#include "Factories/PipelineManagerFactory.h"
+#include "Utils/PipelineConfig.h"
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * PipelineConfigTest
+ * ------------------
+ * Parsing and validation of pipeline configuration files, and enforcement of each stage's `emits`
+ * list by the executor.
+ */
+
+static bool Parse(const std::string& text, PipelineConfig& config, std::vector<std::string>& errors) {
+    std::istringstream in(text);
+    return ParsePipelineConfig(in, config, errors) && ValidatePipelineConfig(config, errors);
+}
+
+static bool Accepts(const std::string& text) {
+    PipelineConfig config;
+    std::vector<std::string> errors;
+    return Parse(text, config, errors);
+}
+
+static const char* kStage = "[stage decode]\nprocessor = DecodeImageSystem\naccepts = IMAGE\n";
+
+static void CheckCounts() {
+    std::size_t value = 7;
+    CHECK(ParseCount("12", value, 100) && value == 12);
+    CHECK(ParseCount("0", value, 100, true) && value == 0);
+    CHECK(!ParseCount("0", value, 100));
+    CHECK(!ParseCount("101", value, 100));
+    CHECK(!ParseCount("-1", value, 100));
+    CHECK(!ParseCount("+3", value, 100));
+    CHECK(!ParseCount("3x", value, 100));
+    CHECK(!ParseCount("", value, 100));
+    // Values that wrap around in strtoul must not come back as small numbers.
+    CHECK(!ParseCount("18446744073709551617", value, kMaxConfigQueueDepth));
+    CHECK(!ParseCount("4294967297", value, kMaxConfigQueueDepth));
+    CHECK(!ParseCount("99999999999999999999999999", value, kMaxConfigQueueDepth));
+    CHECK(value == 0);
+
+    CHECK(Accepts(std::string("[loader]\nthreads = 1024\n") + kStage));
+    CHECK(!Accepts(std::string("[loader]\nthreads = 1025\n") + kStage));
+    CHECK(!Accepts(std::string("[loader]\nthreads = 18446744073709551617\n") + kStage));
+    CHECK(!Accepts(std::string(kStage) + "threads = 5000000\n"));
+    CHECK(!Accepts(std::string(kStage) + "queue_depth = 2000000\n"));
+    CHECK(!Accepts(std::string(kStage) + "batch_size = 0\n"));
+    CHECK(Accepts(std::string("[limits]\nitem_timeout_ms = 86400000\n") + kStage));
+    CHECK(!Accepts(std::string("[limits]\nitem_timeout_ms = 86400001\n") + kStage));
+
+    PipelineConfig config;
+    std::vector<std::string> errors;
+    CHECK(!Parse(std::string(kStage) + "threads = 5000000\n", config, errors));
+    CHECK(errors.size() == 1 && errors[0].find("from 1 to 1024") != std::string::npos);
+}
+
+static void CheckGraph() {
+    PipelineConfig config;
+    std::vector<std::string> errors;
+    std::string text = "[loader]\nthreads = 2\n"
+                       "[stage unzip]\nprocessor = DecompressSystem\naccepts = COMPRESSED\nemits = IMAGE, COMPRESSED\n"
+                       "threads = 3\nbatch_size = 4\n"
+                       "[stage decode]\nprocessor = DecodeImageSystem\naccepts = IMAGE\n";
+    CHECK(Parse(text, config, errors));
+    CHECK(errors.empty());
+    CHECK(config.loaderThreads == 2);
+    CHECK(config.stages.size() == 2 && config.stages[0].threads == 3 && config.stages[0].batchSize == 4);
+
+    CompiledPipeline compiled;
+    CHECK(PipelineManagerFactory::CompilePipeline(config, compiled, errors));
+    CHECK(compiled.StageFor(DataType::COMPRESSED) == 0);
+    CHECK(compiled.StageFor(DataType::IMAGE) == 1);
+    CHECK(compiled.StageFor(DataType::JSON) == -1);
+    CHECK(compiled.stages[0].Emits(DataType::IMAGE) && !compiled.stages[0].Emits(DataType::JSON));
+
+    // Ambiguous dispatch, undeclared consumers, cycles and unknown processors are rejected.
+    CHECK(!Accepts(std::string(kStage) + "[stage other]\nprocessor = ParseJsonSystem\naccepts = IMAGE\n"));
+    CHECK(!Accepts(std::string(kStage) + "emits = JSON\n"));
+    CHECK(!Accepts("[stage a]\nprocessor = DecodeImageSystem\naccepts = IMAGE\nemits = JSON\n"
+                   "[stage b]\nprocessor = ParseJsonSystem\naccepts = JSON\nemits = IMAGE\n"));
+    CHECK(!Accepts("[stage a]\nprocessor = DecodeImageSystem\naccepts = PICTURE\n"));
+    CHECK(!Accepts(""));
+    errors.clear();
+    CHECK(Parse("[stage a]\nprocessor = NoSuchSystem\naccepts = IMAGE\n", config, errors));
+    CHECK(!PipelineManagerFactory::CompilePipeline(config, compiled, errors));
+}
+
+// A stage whose processor produces a type missing from its `emits` list stops the item instead of
+// routing it along an edge the validated graph does not have.
+static void CheckEmitsEnforced() {
+    PipelineConfig config;
+    std::vector<std::string> errors;
+    std::string text = "[stage unzip]\nprocessor = DecompressSystem\naccepts = COMPRESSED\nthreads = 2\n"
+                       "[stage decode]\nprocessor = DecodeImageSystem\naccepts = IMAGE\n"
+                       "[stage json]\nprocessor = ParseJsonSystem\naccepts = JSON\n";
+    CHECK(Parse(text, config, errors));
+    CompiledPipeline compiled;
+    CHECK(PipelineManagerFactory::CompilePipeline(config, compiled, errors));
+
+    std::vector<std::string> sources;
+    for (int i = 0; i < 32; ++i) sources.push_back("bundle://archive" + std::to_string(i) + ".zip");
+    sources.push_back("file://photo.jpg");
+    std::unique_ptr<PipelineExecutor> executor = PipelineManagerFactory::CreatePipelineExecutor(compiled);
+    std::vector<std::unique_ptr<ActionResult>> results = executor->RunEach(sources);
+
+    CHECK(results.size() == sources.size());
+    for (std::size_t i = 0; i + 1 < results.size(); ++i) {
+        CHECK(results[i] != nullptr);
+        if (!results[i]) continue;
+        auto stopped = results[i]->metadata.find("Pipeline Stopped");
+        CHECK(stopped != results[i]->metadata.end());
+        if (stopped != results[i]->metadata.end()) CHECK(stopped->second.find("Stage 'unzip' emitted undeclared type") == 0);
+        CHECK(results[i]->data.empty());
+    }
+    CHECK(results.back() && results.back()->metadata.count("Pipeline Stopped") == 0);
+    CHECK(executor->LastRunStats().stoppedItems == sources.size() - 1);
+}
+
+int main() {
+    QuietOutput quiet;
+    CheckCounts();
+    CheckGraph();
+    CheckEmitsEnforced();
+    return TestResult();
+}
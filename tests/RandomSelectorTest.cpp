@@ -0,0 +1,74 @@
+#include "TestSupport.h"
+#include "Systems/DecompressSystem.h"
+#include "Utils/RandomSelector.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * RandomSelectorTest
+ * ------------------
+ * Strict seed parsing, and extension choices that depend only on the seed, the key and the salt
+ * (not on the thread or the order of calls). A malformed "Archive Depth" does not throw.
+ */
+
+static void CheckParseSeed() {
+    std::uint64_t seed = 9;
+    CHECK(ParseSeed("0", seed) && seed == 0);
+    CHECK(ParseSeed("42", seed) && seed == 42);
+    CHECK(ParseSeed("18446744073709551615", seed) && seed == 18446744073709551615ull);
+    CHECK(!ParseSeed("18446744073709551616", seed));
+    CHECK(!ParseSeed("12x", seed));
+    CHECK(!ParseSeed("7 junk", seed));
+    CHECK(!ParseSeed(" 7", seed));
+    CHECK(!ParseSeed("-1", seed));
+    CHECK(!ParseSeed("", seed));
+    CHECK(seed == 18446744073709551615ull);
+}
+
+static std::vector<std::string> Choices(std::size_t first, std::size_t count) {
+    std::vector<std::string> choices;
+    for (std::size_t i = first; i < first + count; ++i) choices.push_back(GetRandomExtension("key" + std::to_string(i), i % 3));
+    return choices;
+}
+
+static void CheckDeterminism() {
+    SetRandomSeed(5);
+    std::vector<std::string> expected = Choices(0, 64);
+
+    // Another thread, and a different call history, give the same choices.
+    std::vector<std::string> other;
+    std::thread worker([&other] {
+        Choices(100, 10);
+        other = Choices(0, 64);
+    });
+    worker.join();
+    CHECK(other == expected);
+
+    SetRandomSeed(6);
+    CHECK(Choices(0, 64) != expected);
+    SetRandomSeed(kDefaultRandomSeed);
+}
+
+static void CheckMalformedDepth() {
+    DecompressSystem system;
+    // Depths past kMaxArchiveDepth are malformed too (UINT64_MAX + 1 would wrap to depth 0).
+    for (const char* depth : { "abc", "", "-1", "99999999999999999999999", "18446744073709551615", "1025" }) {
+        ActionResult item(DataType::COMPRESSED, "bundle://archive.zip", "none"_sr, "Compressed"_sr);
+        item.metadata["Archive Depth"] = depth;
+        system.Process(item);
+        CHECK(item.metadata["Archive Depth"] == "1");
+    }
+    ActionResult nested(DataType::COMPRESSED, "bundle://archive.zip", "none"_sr, "Compressed"_sr);
+    nested.metadata["Archive Depth"] = "1024";
+    system.Process(nested);
+    CHECK(nested.metadata["Archive Depth"] == "1025");
+}
+
+int main() {
+    QuietOutput quiet;
+    CheckParseSeed();
+    CheckDeterminism();
+    CheckMalformedDepth();
+    return TestResult();
+}
@@ -0,0 +1,197 @@
+#include "TestSupport.h"
+#include "Sinks/ResultColumnReader.h"
+#include "Sinks/ResultColumnWriter.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/**
+ * ResultColumnsTest
+ * -----------------
+ * Round trip through ResultColumnWriter and ResultColumnReader, rejection of corrupted files, and
+ * atomic replacement of an existing (possibly mapped) result file through a unique temporary file.
+ */
+
+static std::vector<char> ReadBytes(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void WriteBytes(const std::string& path, const std::vector<char>& bytes) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+// Number of files in the scratch directory that are left-over temporaries of `path` (`path.XXXXXX`).
+static std::size_t TemporariesOf(const std::string& path) {
+    std::string directory = path.substr(0, path.rfind('/'));
+    std::string prefix = path.substr(directory.size() + 1) + ".";
+    std::size_t count = 0;
+    DIR* listing = ::opendir(directory.c_str());
+    if (listing == nullptr) return 0;
+    while (const dirent* entry = ::readdir(listing)) {
+        std::string name = entry->d_name;
+        if (name.size() == prefix.size() + 6 && name.compare(0, prefix.size(), prefix) == 0) ++count;
+    }
+    ::closedir(listing);
+    return count;
+}
+
+static ResultColumnsHeader HeaderOf(const std::vector<char>& bytes) {
+    ResultColumnsHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    return header;
+}
+
+template <typename T>
+static void Poke(std::vector<char>& bytes, std::uint64_t offset, T value) {
+    std::memcpy(bytes.data() + offset, &value, sizeof(value));
+}
+
+// Writes a modified copy of `good` and checks that the reader rejects it.
+template <typename Corrupt>
+static bool Rejects(const std::vector<char>& good, Corrupt corrupt) {
+    std::vector<char> bytes = good;
+    ResultColumnsHeader header = HeaderOf(bytes);
+    corrupt(bytes, header);
+    std::string path = TempPath("corrupt.cpr");
+    WriteBytes(path, bytes);
+    ResultColumnReader reader;
+    return !reader.Open(path);
+}
+
+static ResultColumnWriter MakeWriter(const std::string& prefix, std::size_t rows) {
+    ResultColumnWriter writer;
+    for (std::size_t i = 0; i < rows; ++i) {
+        ActionResult item(i % 2 ? DataType::IMAGE : DataType::JSON, prefix + std::to_string(i) + (i % 2 ? ".jpg" : ".json"),
+                          "file"_sr, i % 2 ? "Decoded Image"_sr : "Parsed JSON"_sr);
+        item.isProcessed = i != 1;
+        item.metadata["Action"] = i % 2 ? "Image Decoded" : "JSON Parsed";
+        if (i == 2) item.metadata["Row"] = "two";
+        writer.Append(item);
+    }
+    return writer;
+}
+
+static void CheckRoundTrip(const std::string& path) {
+    ResultColumnWriter writer = MakeWriter("file://row", 3);
+    CHECK(writer.RowCount() == 3);
+    CHECK(writer.WriteFile(path));
+    CHECK(TemporariesOf(path) == 0);
+
+    ResultColumnReader reader;
+    CHECK(reader.Open(path));
+    CHECK(reader.RowCount() == 3);
+    if (reader.RowCount() != 3) return;
+    CHECK(reader.Source(0).str() == "file://row0.json");
+    CHECK(reader.Source(1).str() == "file://row1.jpg");
+    CHECK(reader.Type(0) == DataType::JSON && reader.Type(1) == DataType::IMAGE);
+    CHECK(reader.IsProcessed(0) && !reader.IsProcessed(1) && reader.IsProcessed(2));
+    CHECK(reader.Protocol(2).str() == "file");
+    CHECK(reader.Content(1).str() == "Decoded Image");
+    CHECK(reader.MetadataCount(0) == 1 && reader.MetadataCount(2) == 2);
+    CHECK(reader.MetadataKey(1, 0).str() == "Action" && reader.MetadataValue(1, 0).str() == "Image Decoded");
+    // Repeated strings are stored once: file, 2 contents, Action, 2 action values, Row, two.
+    CHECK(reader.DictionarySize() == 8);
+
+    ResultColumnWriter empty;
+    CHECK(empty.WriteFile(path + ".empty"));
+    ResultColumnReader emptyReader;
+    CHECK(emptyReader.Open(path + ".empty") && emptyReader.RowCount() == 0);
+}
+
+static void CheckCorruption(const std::string& path) {
+    std::vector<char> good = ReadBytes(path);
+    CHECK(good.size() > sizeof(ResultColumnsHeader));
+    CHECK(!Rejects(good, [](std::vector<char>&, ResultColumnsHeader&) {}));
+
+    // Header fields.
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader&) { b[0] = 'X'; }));
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader&) { b.resize(b.size() - 8); }));
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader&) { b.resize(sizeof(ResultColumnsHeader) - 1); }));
+    // (rows + 1) * 8 would wrap around to a small size.
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader&) {
+        Poke<std::uint64_t>(b, offsetof(ResultColumnsHeader, rowCount), (std::uint64_t(1) << 61) - 1);
+    }));
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader&) {
+        Poke<std::uint64_t>(b, offsetof(ResultColumnsHeader, metaPairCount), ~std::uint64_t(0));
+    }));
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader&) {
+        Poke<std::uint64_t>(b, offsetof(ResultColumnsHeader, dictCount), ~std::uint64_t(0));
+    }));
+    // Sections out of layout order (types overlapping the source blob).
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader& h) {
+        Poke<std::uint64_t>(b, offsetof(ResultColumnsHeader, types), h.sourceBytes);
+        Poke<std::uint64_t>(b, offsetof(ResultColumnsHeader, sourceBytes), h.types);
+    }));
+
+    // Offset tables: decreasing, or ending past their blob / pair count.
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader& h) {
+        Poke<std::uint64_t>(b, h.sourceOffsets + 8, 1000);
+    }));
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader& h) {
+        Poke<std::uint64_t>(b, h.sourceOffsets + 3 * 8, h.types - h.sourceBytes + 1);
+    }));
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader& h) {
+        Poke<std::uint64_t>(b, h.metaOffsets + 3 * 8, h.metaPairCount + 1);
+    }));
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader& h) {
+        Poke<std::uint64_t>(b, h.metaOffsets + 8, 3);
+    }));
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader& h) {
+        Poke<std::uint64_t>(b, h.dictOffsets + h.dictCount * 8, b.size());
+    }));
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader& h) {
+        Poke<std::uint64_t>(b, h.dictOffsets + 8, 500);
+    }));
+
+    // Types outside DataType.
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader& h) {
+        Poke<std::uint8_t>(b, h.types + 2, static_cast<std::uint8_t>(kDataTypeCount));
+    }));
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader& h) { Poke<std::uint8_t>(b, h.types, 0xFF); }));
+
+    // Dictionary ids.
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader& h) {
+        Poke<std::uint32_t>(b, h.protocols + 4, static_cast<std::uint32_t>(h.dictCount));
+    }));
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader& h) {
+        Poke<std::uint32_t>(b, h.contents, 0xFFFFFFFFu);
+    }));
+    CHECK(Rejects(good, [](std::vector<char>& b, ResultColumnsHeader& h) {
+        Poke<std::uint32_t>(b, h.metaPairs + 8 * (h.metaPairCount - 1) + 4, static_cast<std::uint32_t>(h.dictCount));
+    }));
+}
+
+// Rewriting a file that a reader still maps replaces it by rename: the open mapping keeps the old rows.
+// A file at the old fixed temporary name (another writer's, say) is left alone.
+static void CheckAtomicReplace(const std::string& path) {
+    WriteBytes(path + ".tmp", std::vector<char>{ 'k', 'e', 'e', 'p' });
+    ResultColumnReader before;
+    CHECK(before.Open(path));
+    ResultColumnWriter writer = MakeWriter("file://replaced", 1);
+    CHECK(writer.WriteFile(path));
+    CHECK(before.RowCount() == 3 && before.Source(2).str() == "file://row2.json");
+
+    ResultColumnReader after;
+    CHECK(after.Open(path));
+    CHECK(after.RowCount() == 1 && after.Source(0).str() == "file://replaced0.json");
+    CHECK(TemporariesOf(path) == 0);
+    CHECK(ReadBytes(path + ".tmp") == (std::vector<char>{ 'k', 'e', 'e', 'p' }));
+
+    // A target in a missing directory fails cleanly.
+    CHECK(!writer.WriteFile(TempPath("missing/results.cpr")));
+}
+
+int main() {
+    std::string path = TempPath("results.cpr");
+    CheckRoundTrip(path);
+    CheckCorruption(path);
+    CheckAtomicReplace(path);
+    return TestResult();
+}
@@ -0,0 +1,64 @@
+#include "TestSupport.h"
+#include "Utils/SchemeDetector.h"
+#include "Utils/TypeDetector.h"
+#include <string>
+#include <vector>
+
+/**
+ * SchemeDetectorTest
+ * ------------------
+ * The batch scheme and type classifiers agree with the single-source ones (short and long sources,
+ * prefixes that share leading bytes), and file types are detected by extension with the documented
+ * precedence.
+ */
+
+int main() {
+    std::vector<std::string> sources = {
+        "file://a.jpg", "http://a.json", "https://a.zip", "bundle://a.zip", "ftp://a.jpg",
+        "", "file:/", "file://", "http:/", "https:", "bundle:/", "bundle://",
+        "FILE://upper.jpg", "httpx://a", " file://leading-space.jpg", "https://", "http",
+        "file://exactly16b", "bundle://exact16", "http://a-longer-url.example.com/path/to/file.json",
+        std::string("file://\0embedded.jpg", 20),
+    };
+    std::vector<SourceScheme> expected = {
+        SourceScheme::FILE, SourceScheme::HTTP, SourceScheme::HTTPS, SourceScheme::BUNDLE, SourceScheme::UNKNOWN,
+        SourceScheme::UNKNOWN, SourceScheme::UNKNOWN, SourceScheme::FILE, SourceScheme::UNKNOWN,
+        SourceScheme::UNKNOWN, SourceScheme::UNKNOWN, SourceScheme::BUNDLE,
+        SourceScheme::UNKNOWN, SourceScheme::UNKNOWN, SourceScheme::UNKNOWN, SourceScheme::HTTPS, SourceScheme::UNKNOWN,
+        SourceScheme::FILE, SourceScheme::BUNDLE, SourceScheme::HTTP,
+        SourceScheme::FILE,
+    };
+    CHECK(sources.size() == expected.size());
+
+    std::vector<SourceScheme> batch = DetectSchemes(sources);
+    CHECK(batch.size() == sources.size());
+    for (std::size_t i = 0; i < sources.size() && i < expected.size(); ++i) {
+        CHECK(DetectScheme(sources[i]) == expected[i]);
+        CHECK(batch[i] == expected[i]);
+    }
+
+    CHECK(DetectFileType("file://a.jpg") == DataType::IMAGE);
+    CHECK(DetectFileType("file://a.json") == DataType::JSON);
+    CHECK(DetectFileType("file://a.zip") == DataType::COMPRESSED);
+    CHECK(DetectFileType("file://a.txt") == DataType::UNKNOWN);
+    CHECK(DetectFileType("file://a.zip.jpg") == DataType::IMAGE);
+    CHECK(DetectFileType("file://a.json.zip") == DataType::JSON);
+    CHECK(DetectFileType("http://a-longer-url.example.com/path/archive.zip") == DataType::COMPRESSED);
+    CHECK(DetectFileType("") == DataType::UNKNOWN);
+
+    // Dots on both sides of a 16-byte block boundary, and extensions cut off by the end.
+    sources.push_back("http://example.com/0123456789.jpg");
+    sources.push_back("file://abcdefgh.zip/0123456789abcdef.json");
+    sources.push_back("file://a.jp");
+    sources.push_back("bundle://a.jsonzip.");
+    std::vector<DataType> types = DetectFileTypes(sources);
+    CHECK(types.size() == sources.size());
+    for (std::size_t i = 0; i < sources.size() && i < types.size(); ++i) {
+        CHECK(types[i] == DetectFileType(sources[i]));
+    }
+    CHECK(types[0] == DataType::IMAGE && types[2] == DataType::COMPRESSED && types[4] == DataType::IMAGE);
+    CHECK(types[sources.size() - 4] == DataType::IMAGE && types[sources.size() - 3] == DataType::JSON);
+    CHECK(types[sources.size() - 2] == DataType::UNKNOWN && types[sources.size() - 1] == DataType::JSON);
+
+    return TestResult();
+}
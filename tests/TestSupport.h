@@ -0,0 +1,74 @@
+#ifndef TEST_SUPPORT_H
+#define TEST_SUPPORT_H
+
+#include <cstdlib>
+#include <iostream>
+#include <streambuf>
+#include <string>
+
+/**
+ * TestSupport Utility
+ * -------------------
+ * Minimal helpers shared by the test executables (registered with CTest in CMakeLists.txt).
+ *
+ * - CHECK(condition): Reports a failed condition with its location and keeps running.
+ * - TestResult():     Exit code for main (0 when every CHECK passed).
+ * - QuietOutput:      Discards std::cout (pipeline logging) while in scope.
+ * - TempPath(name):   Path of `name` inside a fresh per-process scratch directory under /tmp.
+ */
+
+namespace TestSupport {
+
+inline int& Failures() {
+    static int failures = 0;
+    return failures;
+}
+
+// Stream buffer that drops everything; it keeps no state, so concurrent writers are safe.
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return traits_type::not_eof(c); }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+} // namespace TestSupport
+
+#define CHECK(condition)                                                                         \
+    do {                                                                                         \
+        if (!(condition)) {                                                                      \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: " << #condition << "\n"; \
+            ++TestSupport::Failures();                                                           \
+        }                                                                                        \
+    } while (0)
+
+inline int TestResult() {
+    if (TestSupport::Failures() == 0) return 0;
+    std::cerr << TestSupport::Failures() << " check(s) failed\n";
+    return 1;
+}
+
+inline std::string TempPath(const std::string& name) {
+    static const std::string directory = [] {
+        char pattern[] = "/tmp/ComputePipelineTest.XXXXXX";
+        const char* created = ::mkdtemp(pattern);
+        return std::string(created != nullptr ? created : "/tmp");
+    }();
+    return directory + "/" + name;
+}
+
+class QuietOutput {
+public:
+    QuietOutput() : previous(std::cout.rdbuf(&discard)) {
+    }
+
+    ~QuietOutput() { std::cout.rdbuf(previous); }
+
+    QuietOutput(const QuietOutput&) = delete;
+    QuietOutput& operator=(const QuietOutput&) = delete;
+
+private:
+    TestSupport::NullBuffer discard;
+    std::streambuf* previous;
+};
+
+#endif